@@ -13,6 +13,10 @@
 #ifndef _BMI08_H
 #define _BMI08_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*********************************************************************/
 /* header files */
 #include "bmi08_defs.h"
@@ -70,6 +74,46 @@ int8_t bmi08a_init(struct bmi08_dev *dev);
  */
 int8_t bmi08a_load_config_file(struct bmi08_dev *dev);
 
+/*!
+ * \ingroup bmi08aApiConfig
+ * \page bmi08a_api_bmi08a_config_stream_init bmi08a_config_stream_init
+ * \code
+ * int8_t bmi08a_config_stream_init(struct bmi08_config_stream *stream, const struct bmi08_dev *dev);
+ * \endcode
+ * @details This API prepares the unpacking of the config stream assigned to
+ * dev->config_file_ptr. When dev->config_file_size is non-zero the stream is
+ * packed, otherwise it is a plain BMI08_CONFIG_STREAM_SIZE byte image.
+ *
+ *  @param[out] stream : Structure instance of bmi08_config_stream.
+ *  @param[in]  dev    : Structure instance of bmi08_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi08a_config_stream_init(struct bmi08_config_stream *stream, const struct bmi08_dev *dev);
+
+/*!
+ * \ingroup bmi08aApiConfig
+ * \page bmi08a_api_bmi08a_config_stream_read bmi08a_config_stream_read
+ * \code
+ * int8_t bmi08a_config_stream_read(struct bmi08_config_stream *stream, uint8_t *data, uint16_t len);
+ * \endcode
+ * @details This API unpacks the next len bytes of a config stream, so the
+ * upload never needs more than one burst in RAM.
+ *
+ *  @param[in,out] stream : Structure instance of bmi08_config_stream.
+ *  @param[out]    data   : Unpacked bytes.
+ *  @param[in]     len    : Number of bytes to unpack.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi08a_config_stream_read(struct bmi08_config_stream *stream, uint8_t *data, uint16_t len);
+
 /**
  * \ingroup bmi08ag
  * \defgroup bmi08aApiFConfig Upload Feature Config File
@@ -668,6 +712,28 @@ int8_t bmi08g_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len,
 int8_t bmi08g_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
                        struct bmi08_dev *dev);
 
+/*!
+ * \ingroup bmi08gApiRegs
+ * \page bmi08g_api_bmi08g_write_seq bmi08g_write_seq
+ * \code
+ * int8_t bmi08g_write_seq(const struct bmi08_reg_write *seq, uint8_t count,
+ * struct bmi08_dev *dev); \endcode
+ * @details This API writes a sequence of single byte registers of the gyro
+ *  sensor. The gyro does not allow burst writes, so when dev->write_seq is set
+ *  the whole sequence is handed to it as one transport call, otherwise one
+ *  dev->write call is made per entry with the gyro write delay in between.
+ *
+ *  @param[in] seq       : Register writes, issued in order.
+ *  @param[in] count     : No. of entries, at most BMI08_GYRO_WRITE_SEQ_MAX.
+ *  @param[in] dev       : Structure instance of bmi08_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ *
+ */
+int8_t bmi08g_write_seq(const struct bmi08_reg_write *seq, uint8_t count, struct bmi08_dev *dev);
+
 /**
  * \ingroup bmi08ag
  * \defgroup bmi08gApiSoftreset gyro Soft reset
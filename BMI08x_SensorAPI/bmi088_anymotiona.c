@@ -74,62 +74,58 @@ struct bmi088_anymotion_selftest_delta_limit
     int16_t z;
 };
 
-/**\name Feature configuration file */
+/**\name Feature configuration file, packed (see BMI08_CONFIG_RLE_REPEAT) */
 const uint8_t bmi088_anymotion_config_file[] = {
-    0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00,
-    0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x44, 0x00, 0x80, 0x2e, 0xe4, 0x01, 0xb0, 0xf0,
-    0x10, 0x30, 0x21, 0x2e, 0x16, 0xf0, 0x80, 0x2e, 0x9f, 0x00, 0x19, 0x50, 0x41, 0x30, 0x01, 0x42, 0x3c, 0x82, 0x01,
-    0x2e, 0x42, 0x00, 0x42, 0x40, 0x42, 0x42, 0x02, 0x30, 0x17, 0x56, 0x25, 0x2e, 0x42, 0x00, 0x03, 0x0a, 0x49, 0x82,
-    0xc0, 0x2e, 0x40, 0x42, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4,
-    0x5b, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0xfd, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x50, 0xd0, 0x7f, 0xf5, 0x7f, 0xe4, 0x7f, 0x34, 0x30, 0x01, 0x2e, 0x01, 0xf0, 0x0e, 0xbc,
-    0x8e, 0xba, 0x92, 0x7f, 0xc1, 0x7f, 0xbb, 0x7f, 0xa3, 0x7f, 0xa5, 0x04, 0x05, 0x52, 0x07, 0x50, 0x98, 0x2e, 0x94,
-    0x00, 0x11, 0x30, 0x23, 0x2e, 0x29, 0x00, 0x01, 0x31, 0x23, 0x2e, 0xb8, 0xf0, 0xe4, 0x6f, 0xd0, 0x6f, 0xf5, 0x6f,
-    0xc1, 0x6f, 0x92, 0x6f, 0xa3, 0x6f, 0xbb, 0x6f, 0x90, 0x5f, 0xc8, 0x2e, 0x98, 0x2e, 0xa8, 0x00, 0x20, 0x26, 0x98,
-    0x2e, 0x90, 0x00, 0x01, 0x2e, 0x40, 0xf0, 0x21, 0x2e, 0x41, 0x00, 0x10, 0x30, 0x21, 0x2e, 0x59, 0xf0, 0x98, 0x2e,
-    0xa3, 0x00, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 0x01, 0x2e, 0x29, 0x00, 0x00, 0xb2, 0x0b, 0x2f, 0x00, 0x30, 0x21,
-    0x2e, 0x29, 0x00, 0x05, 0x50, 0x98, 0x2e, 0x9e, 0x01, 0x20, 0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x05, 0x50, 0x98, 0x2e,
-    0x11, 0x01, 0x98, 0x2e, 0xa3, 0x00, 0x01, 0x2e, 0x42, 0x00, 0x01, 0x30, 0x21, 0x2e, 0x5e, 0xf0, 0x23, 0x2e, 0x42,
-    0x00, 0xe3, 0x2d, 0x00, 0x31, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x43, 0x86, 0x25, 0x40, 0x04, 0x40, 0xd8, 0xbe,
-    0x2c, 0x0b, 0x22, 0x11, 0x54, 0x42, 0x03, 0x80, 0x4b, 0x0e, 0xf6, 0x2f, 0xb8, 0x2e, 0x1a, 0x24, 0x30, 0x00, 0x80,
-    0x2e, 0x65, 0x00, 0x01, 0x2e, 0x55, 0xf0, 0xc0, 0x2e, 0x21, 0x2e, 0x55, 0xf0, 0x15, 0x50, 0x41, 0x30, 0x02, 0x40,
-    0x51, 0x0a, 0x01, 0x42, 0x18, 0x82, 0x09, 0x50, 0x60, 0x42, 0x70, 0x3c, 0x0b, 0x54, 0x42, 0x42, 0x69, 0x82, 0x82,
-    0x32, 0x43, 0x40, 0x18, 0x08, 0x02, 0x0a, 0x40, 0x42, 0x42, 0x80, 0x02, 0x3f, 0x01, 0x40, 0x10, 0x50, 0x4a, 0x08,
-    0xfb, 0x7f, 0x11, 0x42, 0x0b, 0x31, 0x0b, 0x42, 0x3e, 0x80, 0xf1, 0x30, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x40,
+    0x03, 0xc8, 0x2e, 0x00, 0x2e, 0xf5, 0x36, 0x80, 0x2e, 0x44, 0x00, 0x80, 0x2e, 0xe4, 0x01, 0xb0, 0xf0, 0x10, 0x30,
+    0x21, 0x2e, 0x16, 0xf0, 0x80, 0x2e, 0x9f, 0x00, 0x19, 0x50, 0x41, 0x30, 0x01, 0x42, 0x3c, 0x82, 0x01, 0x2e, 0x42,
+    0x00, 0x42, 0x40, 0x42, 0x42, 0x02, 0x30, 0x17, 0x56, 0x25, 0x2e, 0x42, 0x00, 0x03, 0x0a, 0x49, 0x82, 0xc0, 0x2e,
+    0x40, 0x42, 0x00, 0x2e, 0x00, 0x88, 0x05, 0xd4, 0x5b, 0x80, 0x2e, 0x18, 0x00, 0xf1, 0x02, 0xfd, 0x2d, 0x00, 0x8a,
+    0x7f, 0x70, 0x50, 0xd0, 0x7f, 0xf5, 0x7f, 0xe4, 0x7f, 0x34, 0x30, 0x01, 0x2e, 0x01, 0xf0, 0x0e, 0xbc, 0x8e, 0xba,
+    0x92, 0x7f, 0xc1, 0x7f, 0xbb, 0x7f, 0xa3, 0x7f, 0xa5, 0x04, 0x05, 0x52, 0x07, 0x50, 0x98, 0x2e, 0x94, 0x00, 0x11,
+    0x30, 0x23, 0x2e, 0x29, 0x00, 0x01, 0x31, 0x23, 0x2e, 0xb8, 0xf0, 0xe4, 0x6f, 0xd0, 0x6f, 0xf5, 0x6f, 0xc1, 0x6f,
+    0x92, 0x6f, 0xa3, 0x6f, 0xbb, 0x6f, 0x90, 0x5f, 0xc8, 0x2e, 0x98, 0x2e, 0xa8, 0x00, 0x20, 0x26, 0x98, 0x2e, 0x90,
+    0x00, 0x01, 0x2e, 0x40, 0xf0, 0x21, 0x2e, 0x41, 0x00, 0x10, 0x30, 0x21, 0x2e, 0x59, 0xf0, 0x98, 0x2e, 0xa3, 0x00,
+    0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 0x01, 0x2e, 0x29, 0x00, 0x00, 0xb2, 0x0b, 0x2f, 0x00, 0x30, 0x21, 0x2e, 0x29,
+    0x00, 0x05, 0x50, 0x98, 0x2e, 0x9e, 0x01, 0x20, 0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x05, 0x50, 0x7f, 0x98, 0x2e, 0x11,
+    0x01, 0x98, 0x2e, 0xa3, 0x00, 0x01, 0x2e, 0x42, 0x00, 0x01, 0x30, 0x21, 0x2e, 0x5e, 0xf0, 0x23, 0x2e, 0x42, 0x00,
+    0xe3, 0x2d, 0x00, 0x31, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x43, 0x86, 0x25, 0x40, 0x04, 0x40, 0xd8, 0xbe, 0x2c,
+    0x0b, 0x22, 0x11, 0x54, 0x42, 0x03, 0x80, 0x4b, 0x0e, 0xf6, 0x2f, 0xb8, 0x2e, 0x1a, 0x24, 0x30, 0x00, 0x80, 0x2e,
+    0x65, 0x00, 0x01, 0x2e, 0x55, 0xf0, 0xc0, 0x2e, 0x21, 0x2e, 0x55, 0xf0, 0x15, 0x50, 0x41, 0x30, 0x02, 0x40, 0x51,
+    0x0a, 0x01, 0x42, 0x18, 0x82, 0x09, 0x50, 0x60, 0x42, 0x70, 0x3c, 0x0b, 0x54, 0x42, 0x42, 0x69, 0x82, 0x82, 0x32,
+    0x43, 0x40, 0x18, 0x08, 0x02, 0x0a, 0x40, 0x42, 0x42, 0x80, 0x02, 0x3f, 0x01, 0x40, 0x10, 0x50, 0x4a, 0x08, 0xfb,
+    0x7f, 0x11, 0x42, 0x0b, 0x31, 0x0b, 0x42, 0x3e, 0x80, 0xf1, 0x30, 0x6f, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x40,
     0xf0, 0x1e, 0xb2, 0x01, 0x2f, 0x1a, 0x90, 0x20, 0x2f, 0x03, 0x30, 0x0f, 0x50, 0x0d, 0x54, 0xd4, 0x33, 0x06, 0x30,
     0x13, 0x52, 0xf5, 0x32, 0x1d, 0x1a, 0xe3, 0x22, 0x18, 0x1a, 0x11, 0x58, 0xe3, 0x22, 0x04, 0x30, 0xd5, 0x40, 0xb5,
     0x0d, 0xe1, 0xbe, 0x6f, 0xbb, 0x80, 0x91, 0xa9, 0x0d, 0x01, 0x89, 0xb5, 0x23, 0x10, 0xa1, 0xf7, 0x2f, 0xda, 0x0e,
     0xd4, 0x33, 0xeb, 0x2f, 0x01, 0x2e, 0x2f, 0x00, 0x70, 0x1a, 0x00, 0x30, 0x21, 0x30, 0x02, 0x2c, 0x08, 0x22, 0x30,
     0x30, 0x00, 0xb2, 0x06, 0x2f, 0x21, 0x2e, 0x59, 0xf0, 0x98, 0x2e, 0xa3, 0x00, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e,
-    0xfb, 0x6f, 0xf0, 0x5f, 0xb8, 0x2e, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0xaa,
-    0x00, 0x05, 0xe0, 0x2a, 0x00, 0x89, 0xf0, 0xaf, 0x00, 0xff, 0x00, 0xff, 0xb7, 0x00, 0x02, 0x00, 0xb0, 0x05, 0x80,
-    0xb1, 0xf0, 0x80, 0x00, 0x59, 0xf0, 0x40, 0x1c, 0x88, 0x00, 0x3e, 0x00, 0x88, 0x00, 0x09, 0x2e, 0x01, 0x01, 0x0b,
-    0x2e, 0x00, 0x01, 0x42, 0xbd, 0xaf, 0xb9, 0xc1, 0xbc, 0x54, 0xbf, 0x1f, 0xb9, 0xef, 0xbb, 0xcf, 0xb8, 0x9a, 0x0b,
-    0x10, 0x50, 0xc0, 0xb3, 0xb1, 0x0b, 0x77, 0x2f, 0x80, 0xb3, 0x75, 0x2f, 0x0f, 0x2e, 0x43, 0x00, 0x01, 0x8c, 0xc0,
-    0x91, 0x13, 0x2f, 0xc1, 0x83, 0x23, 0x2e, 0x43, 0x00, 0x00, 0x40, 0x21, 0x2e, 0x3d, 0x00, 0x1f, 0x50, 0x91, 0x41,
-    0x11, 0x42, 0x01, 0x30, 0x82, 0x41, 0x02, 0x42, 0xf0, 0x5f, 0x23, 0x2e, 0x2d, 0x00, 0x23, 0x2e, 0x2e, 0x00, 0x23,
-    0x2e, 0x40, 0x00, 0xb8, 0x2e, 0xd5, 0xbe, 0xc3, 0xbf, 0x55, 0xba, 0xc0, 0xb2, 0xf3, 0xba, 0x07, 0x30, 0x03, 0x30,
-    0x09, 0x2f, 0xf0, 0x7f, 0x00, 0x2e, 0x00, 0x40, 0x07, 0x2e, 0x3d, 0x00, 0x03, 0x04, 0x00, 0xa8, 0xf8, 0x04, 0xc3,
-    0x22, 0xf0, 0x6f, 0x80, 0xb2, 0x07, 0x2f, 0x82, 0x41, 0x0f, 0x2e, 0x3e, 0x00, 0x97, 0x04, 0x07, 0x30, 0x80, 0xa8,
-    0xfa, 0x05, 0xd7, 0x23, 0x40, 0xb2, 0x01, 0x30, 0x02, 0x30, 0x0a, 0x2f, 0x02, 0x84, 0xf7, 0x7f, 0x00, 0x2e, 0x82,
-    0x40, 0x0f, 0x2e, 0x3f, 0x00, 0x97, 0x04, 0x80, 0xa8, 0xca, 0x05, 0x97, 0x22, 0xf7, 0x6f, 0x5c, 0x0f, 0x0f, 0x2f,
-    0x7c, 0x0f, 0x0d, 0x2f, 0x54, 0x0f, 0x0b, 0x2f, 0x05, 0x2e, 0x2e, 0x00, 0x81, 0x84, 0x23, 0x2e, 0x2d, 0x00, 0x55,
-    0x0e, 0x25, 0x2e, 0x2e, 0x00, 0x0e, 0x2f, 0x23, 0x2e, 0x40, 0x00, 0x0c, 0x2d, 0x07, 0x2e, 0x2d, 0x00, 0x12, 0x30,
-    0xda, 0x28, 0x23, 0x2e, 0x2e, 0x00, 0x5d, 0x0e, 0x27, 0x2e, 0x2d, 0x00, 0x01, 0x2f, 0x25, 0x2e, 0x40, 0x00, 0x03,
-    0x2e, 0x40, 0x00, 0x40, 0xb2, 0x12, 0x2f, 0x00, 0x40, 0x21, 0x2e, 0x3d, 0x00, 0x1f, 0x50, 0x91, 0x41, 0x11, 0x42,
-    0x21, 0x30, 0x82, 0x41, 0x02, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x42, 0x00, 0x01, 0x0a, 0x21, 0x2e, 0x42, 0x00, 0x03,
-    0x2d, 0x00, 0x30, 0x21, 0x2e, 0x43, 0x00, 0xf0, 0x5f, 0xb8, 0x2e, 0x60, 0x50, 0x03, 0x2e, 0x0e, 0x01, 0xe0, 0x7f,
-    0xf1, 0x7f, 0xdb, 0x7f, 0x30, 0x30, 0x21, 0x54, 0x0a, 0x1a, 0x28, 0x2f, 0x1a, 0x25, 0x7a, 0x82, 0x00, 0x30, 0x43,
-    0x30, 0x32, 0x30, 0x05, 0x30, 0x04, 0x30, 0xf6, 0x6f, 0xf2, 0x09, 0xfc, 0x13, 0xc2, 0xab, 0xb3, 0x09, 0xef, 0x23,
-    0x80, 0xb3, 0xe6, 0x6f, 0xb7, 0x01, 0x00, 0x2e, 0x8b, 0x41, 0x4b, 0x42, 0x03, 0x2f, 0x46, 0x40, 0x86, 0x17, 0x81,
-    0x8d, 0x46, 0x42, 0x41, 0x8b, 0x23, 0xbd, 0xb3, 0xbd, 0x03, 0x89, 0x41, 0x82, 0x07, 0x0c, 0x43, 0xa3, 0xe6, 0x2f,
-    0xe1, 0x6f, 0xa2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xb2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xc2, 0x6f, 0x42, 0x42, 0x03,
-    0xb2, 0x06, 0x2f, 0x01, 0x2e, 0x59, 0xf0, 0x01, 0x32, 0x01, 0x0a, 0x21, 0x2e, 0x59, 0xf0, 0x06, 0x2d, 0x01, 0x2e,
-    0x59, 0xf0, 0xf1, 0x3d, 0x01, 0x08, 0x21, 0x2e, 0x59, 0xf0, 0xdb, 0x6f, 0xa0, 0x5f, 0xb8, 0x2e, 0x00, 0x2e, 0x10,
-    0x24, 0xfa, 0x01, 0x11, 0x24, 0x00, 0x0c, 0x12, 0x24, 0x80, 0x2e, 0x13, 0x24, 0x18, 0x00, 0x12, 0x42, 0x13, 0x42,
-    0x41, 0x1a, 0xfb, 0x2f, 0x10, 0x24, 0x50, 0x39, 0x11, 0x24, 0x21, 0x2e, 0x21, 0x2e, 0x10, 0x00, 0x23, 0x2e, 0x11,
-    0x00, 0x80, 0x2e, 0x10, 0x00
+    0xfb, 0x6f, 0xf0, 0x5f, 0xb8, 0x2e, 0x80, 0x2e, 0x18, 0x00, 0xe5, 0x70, 0xaa, 0x00, 0x05, 0xe0, 0x2a, 0x00, 0x89,
+    0xf0, 0xaf, 0x00, 0xff, 0x00, 0xff, 0xb7, 0x00, 0x02, 0x00, 0xb0, 0x05, 0x80, 0xb1, 0xf0, 0x80, 0x00, 0x59, 0xf0,
+    0x40, 0x1c, 0x88, 0x00, 0x3e, 0x00, 0x88, 0x00, 0x09, 0x2e, 0x01, 0x01, 0x0b, 0x2e, 0x00, 0x01, 0x42, 0xbd, 0xaf,
+    0xb9, 0xc1, 0xbc, 0x54, 0xbf, 0x1f, 0xb9, 0xef, 0xbb, 0xcf, 0xb8, 0x9a, 0x0b, 0x10, 0x50, 0xc0, 0xb3, 0xb1, 0x0b,
+    0x77, 0x2f, 0x80, 0xb3, 0x75, 0x2f, 0x0f, 0x2e, 0x43, 0x00, 0x01, 0x8c, 0xc0, 0x91, 0x13, 0x2f, 0xc1, 0x83, 0x23,
+    0x2e, 0x43, 0x00, 0x00, 0x40, 0x21, 0x2e, 0x3d, 0x00, 0x1f, 0x50, 0x91, 0x41, 0x11, 0x42, 0x01, 0x30, 0x82, 0x41,
+    0x02, 0x42, 0xf0, 0x5f, 0x23, 0x2e, 0x2d, 0x00, 0x23, 0x2e, 0x2e, 0xe0, 0x7f, 0x40, 0x00, 0xb8, 0x2e, 0xd5, 0xbe,
+    0xc3, 0xbf, 0x55, 0xba, 0xc0, 0xb2, 0xf3, 0xba, 0x07, 0x30, 0x03, 0x30, 0x09, 0x2f, 0xf0, 0x7f, 0x00, 0x2e, 0x00,
+    0x40, 0x07, 0x2e, 0x3d, 0x00, 0x03, 0x04, 0x00, 0xa8, 0xf8, 0x04, 0xc3, 0x22, 0xf0, 0x6f, 0x80, 0xb2, 0x07, 0x2f,
+    0x82, 0x41, 0x0f, 0x2e, 0x3e, 0x00, 0x97, 0x04, 0x07, 0x30, 0x80, 0xa8, 0xfa, 0x05, 0xd7, 0x23, 0x40, 0xb2, 0x01,
+    0x30, 0x02, 0x30, 0x0a, 0x2f, 0x02, 0x84, 0xf7, 0x7f, 0x00, 0x2e, 0x82, 0x40, 0x0f, 0x2e, 0x3f, 0x00, 0x97, 0x04,
+    0x80, 0xa8, 0xca, 0x05, 0x97, 0x22, 0xf7, 0x6f, 0x5c, 0x0f, 0x0f, 0x2f, 0x7c, 0x0f, 0x0d, 0x2f, 0x54, 0x0f, 0x0b,
+    0x2f, 0x05, 0x2e, 0x2e, 0x00, 0x81, 0x84, 0x23, 0x2e, 0x2d, 0x00, 0x55, 0x0e, 0x25, 0x2e, 0x2e, 0x00, 0x0e, 0x2f,
+    0x23, 0x2e, 0x40, 0x00, 0x0c, 0x2d, 0x07, 0x2e, 0x16, 0x2d, 0x00, 0x12, 0x30, 0xda, 0x28, 0x23, 0x2e, 0x2e, 0x00,
+    0x5d, 0x0e, 0x27, 0x2e, 0x2d, 0x00, 0x01, 0x2f, 0x25, 0x2e, 0x40, 0x00, 0x03, 0xe0, 0x7f, 0x40, 0xb2, 0x12, 0x2f,
+    0x00, 0x40, 0x21, 0x2e, 0x3d, 0x00, 0x1f, 0x50, 0x91, 0x41, 0x11, 0x42, 0x21, 0x30, 0x82, 0x41, 0x02, 0x42, 0x00,
+    0x2e, 0x01, 0x2e, 0x42, 0x00, 0x01, 0x0a, 0x21, 0x2e, 0x42, 0x00, 0x03, 0x2d, 0x00, 0x30, 0x21, 0x2e, 0x43, 0x00,
+    0xf0, 0x5f, 0xb8, 0x2e, 0x60, 0x50, 0x03, 0x2e, 0x0e, 0x01, 0xe0, 0x7f, 0xf1, 0x7f, 0xdb, 0x7f, 0x30, 0x30, 0x21,
+    0x54, 0x0a, 0x1a, 0x28, 0x2f, 0x1a, 0x25, 0x7a, 0x82, 0x00, 0x30, 0x43, 0x30, 0x32, 0x30, 0x05, 0x30, 0x04, 0x30,
+    0xf6, 0x6f, 0xf2, 0x09, 0xfc, 0x13, 0xc2, 0xab, 0xb3, 0x09, 0xef, 0x23, 0x80, 0xb3, 0xe6, 0x6f, 0xb7, 0x01, 0x00,
+    0x2e, 0x8b, 0x41, 0x4b, 0x42, 0x03, 0x2f, 0x46, 0x40, 0x86, 0x17, 0x81, 0x8d, 0x46, 0x42, 0x41, 0x8b, 0x23, 0xbd,
+    0xb3, 0xbd, 0x03, 0x89, 0x41, 0x82, 0x07, 0x0c, 0x43, 0xa3, 0x64, 0xe6, 0x2f, 0xe1, 0x6f, 0xa2, 0x6f, 0x52, 0x42,
+    0x00, 0x2e, 0xb2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xc2, 0x6f, 0x42, 0x42, 0x03, 0xb2, 0x06, 0x2f, 0x01, 0x2e, 0x59,
+    0xf0, 0x01, 0x32, 0x01, 0x0a, 0x21, 0x2e, 0x59, 0xf0, 0x06, 0x2d, 0x01, 0x2e, 0x59, 0xf0, 0xf1, 0x3d, 0x01, 0x08,
+    0x21, 0x2e, 0x59, 0xf0, 0xdb, 0x6f, 0xa0, 0x5f, 0xb8, 0x2e, 0x00, 0x2e, 0x10, 0x24, 0xfa, 0x01, 0x11, 0x24, 0x00,
+    0x0c, 0x12, 0x24, 0x80, 0x2e, 0x13, 0x24, 0x18, 0x00, 0x12, 0x42, 0x13, 0x42, 0x41, 0x1a, 0xfb, 0x2f, 0x10, 0x24,
+    0x50, 0x39, 0x11, 0x24, 0x21, 0x2e, 0x21, 0x2e, 0x10, 0x00, 0x23, 0x2e, 0x11, 0x00, 0x80, 0x2e, 0x10
 };
 
 /****************************************************************************/
@@ -408,6 +404,7 @@ int8_t bmi088_anymotion_init(struct bmi08_dev *dev)
 
             /* Assign stream file */
             dev->config_file_ptr = bmi088_anymotion_config_file;
+            dev->config_file_size = sizeof(bmi088_anymotion_config_file);
         }
         else
         {
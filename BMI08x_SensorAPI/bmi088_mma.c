@@ -73,332 +73,227 @@ struct bmi088_mm_selftest_delta_limit
     int16_t z;
 };
 
-/**\name Feature configuration file */
+/**\name Feature configuration file, packed (see BMI08_CONFIG_RLE_REPEAT) */
 const uint8_t bmi088_mm_config_file[] = {
-    0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x9b, 0x01, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x3f,
-    0x01, 0x80, 0x2e, 0xbd, 0x00, 0x80, 0x2e, 0x9c, 0x00, 0x80, 0x2e, 0xbe, 0x00, 0x50, 0x39, 0x21, 0x2e, 0xb0, 0xf0,
-    0x10, 0x30, 0x21, 0x2e, 0x16, 0xf0, 0x80, 0x2e, 0xf2, 0x01, 0x4b, 0x50, 0x41, 0x30, 0x01, 0x42, 0x3c, 0x82, 0x01,
-    0x2e, 0x96, 0x00, 0x42, 0x40, 0x42, 0x42, 0x02, 0x30, 0x27, 0x56, 0x25, 0x2e, 0x96, 0x00, 0x03, 0x0a, 0x49, 0x82,
-    0xc0, 0x2e, 0x40, 0x42, 0x00, 0x2e, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0x1b,
-    0x23, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0xfd, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x50, 0xf7, 0x7f, 0x00, 0x2e, 0x0f, 0x2e, 0x43, 0xf0, 0xf8,
-    0xbf, 0xff, 0xbb, 0xc0, 0xb3, 0x11, 0x2f, 0xe6, 0x7f, 0xd5, 0x7f, 0xc4, 0x7f, 0xb3, 0x7f, 0xa2, 0x7f, 0x91, 0x7f,
-    0x80, 0x7f, 0x7b, 0x7f, 0x98, 0x2e, 0xe8, 0xb2, 0x80, 0x6f, 0x91, 0x6f, 0xa2, 0x6f, 0xb3, 0x6f, 0xc4, 0x6f, 0xd5,
-    0x6f, 0xe6, 0x6f, 0x7b, 0x6f, 0x47, 0x30, 0x2f, 0x2e, 0xb8, 0xf0, 0xf7, 0x6f, 0x70, 0x5f, 0xc8, 0x2e, 0xc8, 0x2e,
-    0x70, 0x50, 0xd1, 0x7f, 0xf5, 0x7f, 0xe4, 0x7f, 0x34, 0x30, 0x03, 0x2e, 0x01, 0xf0, 0x9e, 0xbc, 0x9e, 0xba, 0x92,
-    0x7f, 0xc0, 0x7f, 0xbb, 0x7f, 0xa3, 0x7f, 0xa5, 0x04, 0x1f, 0x52, 0x21, 0x50, 0x98, 0x2e, 0xd2, 0x01, 0x10, 0x30,
-    0x21, 0x2e, 0x52, 0x00, 0x98, 0x2e, 0xcc, 0x01, 0x00, 0xb2, 0x01, 0x2f, 0x98, 0x2e, 0xc2, 0x01, 0x98, 0x2e, 0x86,
-    0xb0, 0x00, 0xb2, 0x0d, 0x2f, 0x01, 0x2e, 0x00, 0x01, 0x02, 0xbc, 0x03, 0x2e, 0x2d, 0x00, 0x0e, 0xb8, 0x01, 0x1a,
-    0x03, 0x2f, 0x21, 0x2e, 0x2d, 0x00, 0x98, 0x2e, 0xe1, 0x01, 0x98, 0x2e, 0xdd, 0x01, 0x00, 0x31, 0x21, 0x2e, 0xb8,
-    0xf0, 0xe4, 0x6f, 0xd1, 0x6f, 0xf5, 0x6f, 0xc0, 0x6f, 0x92, 0x6f, 0xa3, 0x6f, 0xbb, 0x6f, 0x90, 0x5f, 0xc8, 0x2e,
-    0x40, 0x30, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x00, 0x31, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x44, 0x47, 0xaa,
-    0x10, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x0c, 0xe8, 0x73, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x30, 0x0a,
-    0x80, 0x00, 0xaa, 0x00, 0x05, 0xe0, 0x41, 0x04, 0x88, 0x00, 0x54, 0x00, 0x89, 0xf0, 0x4f, 0x00, 0x57, 0x00, 0x80,
-    0x00, 0x39, 0xf0, 0x03, 0x01, 0x06, 0x01, 0x0b, 0x01, 0x09, 0x01, 0x59, 0xf0, 0xc0, 0x00, 0xb1, 0xf0, 0xbe, 0xf0,
-    0x00, 0x40, 0xaf, 0x00, 0xff, 0x00, 0xff, 0xb7, 0x00, 0x02, 0x00, 0xb0, 0x05, 0x80, 0xb1, 0xf0, 0x59, 0xf0, 0x5e,
-    0x00, 0x66, 0x00, 0x81, 0x00, 0x64, 0x00, 0x77, 0x00, 0x52, 0xf0, 0x33, 0xf0, 0x70, 0x00, 0x28, 0xf0, 0x7c, 0x00,
-    0x7f, 0x00, 0x7f, 0x00, 0x00, 0xe0, 0xff, 0x07, 0x00, 0x20, 0x00, 0x80, 0xff, 0x1f, 0x87, 0x00, 0x00, 0x10, 0x89,
-    0x00, 0x00, 0x0c, 0x29, 0x00, 0x8f, 0x00, 0x9a, 0x01, 0x88, 0x00, 0x90, 0x50, 0xe5, 0x7f, 0xa0, 0x7f, 0x76, 0x7f,
-    0xbb, 0x7f, 0xf7, 0x7f, 0xd3, 0x7f, 0xc2, 0x7f, 0x91, 0x7f, 0x84, 0x7f, 0x00, 0x32, 0x0b, 0x2e, 0xb8, 0xf0, 0x16,
-    0x30, 0x3c, 0x2c, 0x27, 0x5e, 0xa8, 0x08, 0x80, 0xb2, 0x1c, 0x2f, 0x98, 0x2e, 0x86, 0xb0, 0x00, 0x90, 0x06, 0x2f,
-    0x02, 0x30, 0x00, 0x32, 0x25, 0x2e, 0x97, 0x00, 0x21, 0x2e, 0xbc, 0xf0, 0x0e, 0x2d, 0x01, 0x2e, 0x01, 0xf0, 0x0e,
-    0xbc, 0x0e, 0xb8, 0x32, 0x30, 0x90, 0x04, 0x29, 0x50, 0x23, 0x52, 0x75, 0x25, 0x98, 0x2e, 0xd2, 0x01, 0x2d, 0x2e,
-    0x2e, 0x00, 0x57, 0x25, 0x00, 0x32, 0x21, 0x2e, 0xb8, 0xf0, 0x27, 0x5e, 0xaf, 0x08, 0x80, 0xb2, 0x15, 0x2f, 0x98,
-    0x2e, 0xcc, 0x01, 0x00, 0x90, 0x02, 0x2f, 0x2f, 0x2e, 0xbc, 0xf0, 0x0c, 0x2d, 0x01, 0x2e, 0x01, 0xf0, 0x0e, 0xbc,
-    0x0e, 0xb8, 0x32, 0x30, 0x90, 0x04, 0x29, 0x50, 0x25, 0x52, 0x98, 0x2e, 0xd2, 0x01, 0x2d, 0x2e, 0x53, 0x00, 0x2f,
-    0x2e, 0xb8, 0xf0, 0x00, 0x32, 0x0b, 0x2e, 0xb8, 0xf0, 0xa8, 0x08, 0x80, 0x90, 0xc1, 0x2f, 0xaf, 0x08, 0x80, 0x90,
-    0xbe, 0x2f, 0xf7, 0x6f, 0xe5, 0x6f, 0xd3, 0x6f, 0xc2, 0x6f, 0xa0, 0x6f, 0x91, 0x6f, 0x84, 0x6f, 0x76, 0x6f, 0xbb,
-    0x6f, 0x70, 0x5f, 0xc8, 0x2e, 0x90, 0x50, 0xf7, 0x7f, 0x17, 0x30, 0x2f, 0x2e, 0x5f, 0xf0, 0xe6, 0x7f, 0x00, 0x2e,
-    0x0d, 0x2e, 0xb9, 0xf0, 0xb7, 0x09, 0x80, 0xb3, 0x10, 0x2f, 0xd5, 0x7f, 0xc4, 0x7f, 0xb3, 0x7f, 0xa2, 0x7f, 0x91,
-    0x7f, 0x80, 0x7f, 0x7b, 0x7f, 0x98, 0x2e, 0xd3, 0xb1, 0x80, 0x6f, 0x91, 0x6f, 0xa2, 0x6f, 0xb3, 0x6f, 0xc4, 0x6f,
-    0xd5, 0x6f, 0x7b, 0x6f, 0x17, 0x30, 0x2f, 0x2e, 0xb9, 0xf0, 0xe6, 0x6f, 0xf7, 0x6f, 0x70, 0x5f, 0xc8, 0x2e, 0x10,
-    0x30, 0xc0, 0x2e, 0x21, 0x2e, 0xbb, 0xf0, 0x37, 0x50, 0x35, 0x52, 0x02, 0x40, 0x51, 0x0a, 0x01, 0x42, 0x09, 0x80,
-    0x27, 0x52, 0xc0, 0x2e, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x98, 0x00, 0x01, 0x80, 0xc0, 0x2e, 0x00, 0x40, 0x0f,
-    0xb8, 0x43, 0x86, 0x25, 0x40, 0x04, 0x40, 0xd8, 0xbe, 0x2c, 0x0b, 0x22, 0x11, 0x54, 0x42, 0x03, 0x80, 0x4b, 0x0e,
-    0xf6, 0x2f, 0xb8, 0x2e, 0x00, 0x32, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x39, 0x54, 0x01, 0x30, 0x06, 0x88, 0x81,
-    0x42, 0xf0, 0x30, 0x81, 0x84, 0x20, 0x09, 0x23, 0x30, 0x04, 0x04, 0x93, 0x42, 0x04, 0xbc, 0x81, 0x42, 0x01, 0x80,
-    0xbe, 0x82, 0xc0, 0x2e, 0x40, 0x42, 0x00, 0x2e, 0x1a, 0x24, 0x30, 0x00, 0x80, 0x2e, 0x00, 0xb0, 0x01, 0x2e, 0x55,
-    0xf0, 0xc0, 0x2e, 0x21, 0x2e, 0x55, 0xf0, 0xc0, 0x2e, 0x21, 0x2e, 0x9a, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x10, 0x50,
-    0x98, 0x2e, 0xfe, 0xb0, 0x20, 0x26, 0x98, 0x2e, 0xf7, 0x00, 0x98, 0x2e, 0xbe, 0x01, 0x98, 0x2e, 0xfb, 0x00, 0x2d,
-    0x50, 0x21, 0x2e, 0x99, 0x00, 0x2b, 0x52, 0x23, 0x2e, 0x98, 0x00, 0x2f, 0x50, 0x98, 0x2e, 0xfb, 0x01, 0x31, 0x50,
-    0x98, 0x2e, 0x28, 0xb5, 0x03, 0x2e, 0x40, 0xf0, 0x23, 0x2e, 0x95, 0x00, 0x33, 0x50, 0x11, 0x30, 0x01, 0x42, 0x3f,
-    0x80, 0xf0, 0x7f, 0x98, 0x2e, 0xf6, 0x01, 0xf1, 0x6f, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 0x01, 0x2e, 0x52, 0x00,
-    0x00, 0xb2, 0x1a, 0x2f, 0x02, 0x30, 0x1f, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x52, 0x00, 0x98, 0x2e, 0x0e, 0xb6, 0x80,
-    0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x98, 0x2e, 0xea, 0xb3, 0x00, 0x32, 0x21, 0x2e, 0x5f, 0xf0, 0x1f, 0x50, 0x98, 0x2e,
-    0x34, 0xb4, 0x00, 0x31, 0x21, 0x2e, 0x5f, 0xf0, 0x1f, 0x52, 0x98, 0x2e, 0x2b, 0xb5, 0x21, 0x2e, 0x5a, 0x00, 0xf1,
-    0x6f, 0x01, 0x2e, 0x53, 0x00, 0x00, 0xb2, 0x0e, 0x2f, 0x42, 0x30, 0x25, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x5f, 0xf0,
-    0x98, 0x2e, 0x0e, 0xb6, 0x00, 0x30, 0x21, 0x2e, 0x53, 0x00, 0x98, 0x2e, 0x46, 0xb3, 0x21, 0x2e, 0x5b, 0x00, 0xf1,
-    0x6f, 0x01, 0x2e, 0x2e, 0x00, 0x00, 0xb2, 0x0d, 0x2f, 0x02, 0x30, 0x23, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x2e, 0x00,
-    0x98, 0x2e, 0x0e, 0xb6, 0x20, 0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x23, 0x50, 0x98, 0x2e, 0x50, 0xb1, 0xf1, 0x6f, 0x05,
-    0x2e, 0x5b, 0x00, 0x01, 0x2e, 0x5a, 0x00, 0x23, 0xbd, 0x46, 0x86, 0x10, 0x0a, 0x40, 0x42, 0xf3, 0x7f, 0x98, 0x2e,
+    0x0b, 0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x9b, 0x01, 0xc8, 0x2e, 0x00, 0x2e, 0xe1, 0x0a, 0x80, 0x2e, 0x3f, 0x01,
+    0x80, 0x2e, 0xbd, 0x00, 0x80, 0x2e, 0x9c, 0xe0, 0x45, 0xbe, 0x00, 0x50, 0x39, 0x21, 0x2e, 0xb0, 0xf0, 0x10, 0x30,
+    0x21, 0x2e, 0x16, 0xf0, 0x80, 0x2e, 0xf2, 0x01, 0x4b, 0x50, 0x41, 0x30, 0x01, 0x42, 0x3c, 0x82, 0x01, 0x2e, 0x96,
+    0x00, 0x42, 0x40, 0x42, 0x42, 0x02, 0x30, 0x27, 0x56, 0x25, 0x2e, 0x96, 0x00, 0x03, 0x0a, 0x49, 0x82, 0xc0, 0x2e,
+    0x40, 0x42, 0x00, 0x2e, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0x1b, 0x23, 0x80,
+    0x2e, 0x18, 0x00, 0xff, 0xf3, 0x02, 0xfd, 0x2d, 0x00, 0x9f, 0x9f, 0x9f, 0x8a, 0x04, 0x9a, 0x01, 0x34, 0x03, 0x00,
+    0x9e, 0x7f, 0x90, 0x50, 0xf7, 0x7f, 0x00, 0x2e, 0x0f, 0x2e, 0x43, 0xf0, 0xf8, 0xbf, 0xff, 0xbb, 0xc0, 0xb3, 0x11,
+    0x2f, 0xe6, 0x7f, 0xd5, 0x7f, 0xc4, 0x7f, 0xb3, 0x7f, 0xa2, 0x7f, 0x91, 0x7f, 0x80, 0x7f, 0x7b, 0x7f, 0x98, 0x2e,
+    0xe8, 0xb2, 0x80, 0x6f, 0x91, 0x6f, 0xa2, 0x6f, 0xb3, 0x6f, 0xc4, 0x6f, 0xd5, 0x6f, 0xe6, 0x6f, 0x7b, 0x6f, 0x47,
+    0x30, 0x2f, 0x2e, 0xb8, 0xf0, 0xf7, 0x6f, 0x70, 0x5f, 0xc8, 0x2e, 0xc8, 0x2e, 0x70, 0x50, 0xd1, 0x7f, 0xf5, 0x7f,
+    0xe4, 0x7f, 0x34, 0x30, 0x03, 0x2e, 0x01, 0xf0, 0x9e, 0xbc, 0x9e, 0xba, 0x92, 0x7f, 0xc0, 0x7f, 0xbb, 0x7f, 0xa3,
+    0x7f, 0xa5, 0x04, 0x1f, 0x52, 0x21, 0x50, 0x98, 0x2e, 0xd2, 0x01, 0x10, 0x30, 0x21, 0x2e, 0x52, 0x00, 0x98, 0x2e,
+    0xcc, 0x01, 0x00, 0xb2, 0x01, 0x2f, 0x98, 0x2e, 0xc2, 0x01, 0x98, 0x2e, 0x86, 0xb0, 0x00, 0xb2, 0x7f, 0x0d, 0x2f,
+    0x01, 0x2e, 0x00, 0x01, 0x02, 0xbc, 0x03, 0x2e, 0x2d, 0x00, 0x0e, 0xb8, 0x01, 0x1a, 0x03, 0x2f, 0x21, 0x2e, 0x2d,
+    0x00, 0x98, 0x2e, 0xe1, 0x01, 0x98, 0x2e, 0xdd, 0x01, 0x00, 0x31, 0x21, 0x2e, 0xb8, 0xf0, 0xe4, 0x6f, 0xd1, 0x6f,
+    0xf5, 0x6f, 0xc0, 0x6f, 0x92, 0x6f, 0xa3, 0x6f, 0xbb, 0x6f, 0x90, 0x5f, 0xc8, 0x2e, 0x40, 0x30, 0xc0, 0x2e, 0x21,
+    0x2e, 0xba, 0xf0, 0x00, 0x31, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x44, 0x47, 0xaa, 0x10, 0x05, 0xe0, 0x00, 0x00,
+    0x00, 0x0c, 0xe8, 0x73, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x30, 0x0a, 0x80, 0x00, 0xaa, 0x00, 0x05,
+    0xe0, 0x41, 0x04, 0x88, 0x00, 0x54, 0x00, 0x89, 0xf0, 0x4f, 0x00, 0x57, 0x00, 0x80, 0x00, 0x39, 0xf0, 0x03, 0x01,
+    0x06, 0x01, 0x0b, 0x01, 0x09, 0x01, 0x59, 0xf0, 0xc0, 0x00, 0xb1, 0xf0, 0x28, 0xbe, 0xf0, 0x00, 0x40, 0xaf, 0x00,
+    0xff, 0x00, 0xff, 0xb7, 0x00, 0x02, 0x00, 0xb0, 0x05, 0x80, 0xb1, 0xf0, 0x59, 0xf0, 0x5e, 0x00, 0x66, 0x00, 0x81,
+    0x00, 0x64, 0x00, 0x77, 0x00, 0x52, 0xf0, 0x33, 0xf0, 0x70, 0x00, 0x28, 0xf0, 0x7c, 0x00, 0x7f, 0xa0, 0x7f, 0x00,
+    0xe0, 0xff, 0x07, 0x00, 0x20, 0x00, 0x80, 0xff, 0x1f, 0x87, 0x00, 0x00, 0x10, 0x89, 0x00, 0x00, 0x0c, 0x29, 0x00,
+    0x8f, 0x00, 0x9a, 0x01, 0x88, 0x00, 0x90, 0x50, 0xe5, 0x7f, 0xa0, 0x7f, 0x76, 0x7f, 0xbb, 0x7f, 0xf7, 0x7f, 0xd3,
+    0x7f, 0xc2, 0x7f, 0x91, 0x7f, 0x84, 0x7f, 0x00, 0x32, 0x0b, 0x2e, 0xb8, 0xf0, 0x16, 0x30, 0x3c, 0x2c, 0x27, 0x5e,
+    0xa8, 0x08, 0x80, 0xb2, 0x1c, 0x2f, 0x98, 0x2e, 0x86, 0xb0, 0x00, 0x90, 0x06, 0x2f, 0x02, 0x30, 0x00, 0x32, 0x25,
+    0x2e, 0x97, 0x00, 0x21, 0x2e, 0xbc, 0xf0, 0x0e, 0x2d, 0x01, 0x2e, 0x01, 0xf0, 0x0e, 0xbc, 0x0e, 0xb8, 0x32, 0x30,
+    0x90, 0x04, 0x29, 0x50, 0x23, 0x52, 0x75, 0x25, 0x98, 0x2e, 0xd2, 0x01, 0x2d, 0x2e, 0x2e, 0x00, 0x57, 0x25, 0x00,
+    0x32, 0x21, 0x2e, 0xb8, 0xf0, 0x27, 0x5e, 0xaf, 0x08, 0x80, 0xb2, 0x15, 0x2f, 0x7f, 0x98, 0x2e, 0xcc, 0x01, 0x00,
+    0x90, 0x02, 0x2f, 0x2f, 0x2e, 0xbc, 0xf0, 0x0c, 0x2d, 0x01, 0x2e, 0x01, 0xf0, 0x0e, 0xbc, 0x0e, 0xb8, 0x32, 0x30,
+    0x90, 0x04, 0x29, 0x50, 0x25, 0x52, 0x98, 0x2e, 0xd2, 0x01, 0x2d, 0x2e, 0x53, 0x00, 0x2f, 0x2e, 0xb8, 0xf0, 0x00,
+    0x32, 0x0b, 0x2e, 0xb8, 0xf0, 0xa8, 0x08, 0x80, 0x90, 0xc1, 0x2f, 0xaf, 0x08, 0x80, 0x90, 0xbe, 0x2f, 0xf7, 0x6f,
+    0xe5, 0x6f, 0xd3, 0x6f, 0xc2, 0x6f, 0xa0, 0x6f, 0x91, 0x6f, 0x84, 0x6f, 0x76, 0x6f, 0xbb, 0x6f, 0x70, 0x5f, 0xc8,
+    0x2e, 0x90, 0x50, 0xf7, 0x7f, 0x17, 0x30, 0x2f, 0x2e, 0x5f, 0xf0, 0xe6, 0x7f, 0x00, 0x2e, 0x0d, 0x2e, 0xb9, 0xf0,
+    0xb7, 0x09, 0x80, 0xb3, 0x10, 0x2f, 0xd5, 0x7f, 0xc4, 0x7f, 0xb3, 0x7f, 0xa2, 0x7f, 0x91, 0x7f, 0x80, 0x7f, 0x7b,
+    0x7f, 0x98, 0x2e, 0xd3, 0xb1, 0x80, 0x6f, 0x91, 0x6f, 0x7f, 0xa2, 0x6f, 0xb3, 0x6f, 0xc4, 0x6f, 0xd5, 0x6f, 0x7b,
+    0x6f, 0x17, 0x30, 0x2f, 0x2e, 0xb9, 0xf0, 0xe6, 0x6f, 0xf7, 0x6f, 0x70, 0x5f, 0xc8, 0x2e, 0x10, 0x30, 0xc0, 0x2e,
+    0x21, 0x2e, 0xbb, 0xf0, 0x37, 0x50, 0x35, 0x52, 0x02, 0x40, 0x51, 0x0a, 0x01, 0x42, 0x09, 0x80, 0x27, 0x52, 0xc0,
+    0x2e, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x98, 0x00, 0x01, 0x80, 0xc0, 0x2e, 0x00, 0x40, 0x0f, 0xb8, 0x43, 0x86,
+    0x25, 0x40, 0x04, 0x40, 0xd8, 0xbe, 0x2c, 0x0b, 0x22, 0x11, 0x54, 0x42, 0x03, 0x80, 0x4b, 0x0e, 0xf6, 0x2f, 0xb8,
+    0x2e, 0x00, 0x32, 0xc0, 0x2e, 0x21, 0x2e, 0xba, 0xf0, 0x39, 0x54, 0x01, 0x30, 0x06, 0x88, 0x81, 0x42, 0xf0, 0x30,
+    0x81, 0x84, 0x20, 0x09, 0x23, 0x30, 0x04, 0x04, 0x93, 0x42, 0x04, 0xbc, 0x81, 0x42, 0x01, 0x80, 0xbe, 0x82, 0xc0,
+    0x2e, 0x40, 0x42, 0x00, 0x2e, 0x7f, 0x1a, 0x24, 0x30, 0x00, 0x80, 0x2e, 0x00, 0xb0, 0x01, 0x2e, 0x55, 0xf0, 0xc0,
+    0x2e, 0x21, 0x2e, 0x55, 0xf0, 0xc0, 0x2e, 0x21, 0x2e, 0x9a, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x10, 0x50, 0x98, 0x2e,
+    0xfe, 0xb0, 0x20, 0x26, 0x98, 0x2e, 0xf7, 0x00, 0x98, 0x2e, 0xbe, 0x01, 0x98, 0x2e, 0xfb, 0x00, 0x2d, 0x50, 0x21,
+    0x2e, 0x99, 0x00, 0x2b, 0x52, 0x23, 0x2e, 0x98, 0x00, 0x2f, 0x50, 0x98, 0x2e, 0xfb, 0x01, 0x31, 0x50, 0x98, 0x2e,
+    0x28, 0xb5, 0x03, 0x2e, 0x40, 0xf0, 0x23, 0x2e, 0x95, 0x00, 0x33, 0x50, 0x11, 0x30, 0x01, 0x42, 0x3f, 0x80, 0xf0,
+    0x7f, 0x98, 0x2e, 0xf6, 0x01, 0xf1, 0x6f, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 0x01, 0x2e, 0x52, 0x00, 0x00, 0xb2,
+    0x1a, 0x2f, 0x02, 0x30, 0x1f, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x52, 0x00, 0x98, 0x2e, 0x0e, 0xb6, 0x80, 0x30, 0x21,
+    0x2e, 0x7f, 0x5f, 0xf0, 0x98, 0x2e, 0xea, 0xb3, 0x00, 0x32, 0x21, 0x2e, 0x5f, 0xf0, 0x1f, 0x50, 0x98, 0x2e, 0x34,
+    0xb4, 0x00, 0x31, 0x21, 0x2e, 0x5f, 0xf0, 0x1f, 0x52, 0x98, 0x2e, 0x2b, 0xb5, 0x21, 0x2e, 0x5a, 0x00, 0xf1, 0x6f,
+    0x01, 0x2e, 0x53, 0x00, 0x00, 0xb2, 0x0e, 0x2f, 0x42, 0x30, 0x25, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x5f, 0xf0, 0x98,
+    0x2e, 0x0e, 0xb6, 0x00, 0x30, 0x21, 0x2e, 0x53, 0x00, 0x98, 0x2e, 0x46, 0xb3, 0x21, 0x2e, 0x5b, 0x00, 0xf1, 0x6f,
+    0x01, 0x2e, 0x2e, 0x00, 0x00, 0xb2, 0x0d, 0x2f, 0x02, 0x30, 0x23, 0x50, 0xf1, 0x7f, 0x25, 0x2e, 0x2e, 0x00, 0x98,
+    0x2e, 0x0e, 0xb6, 0x20, 0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x23, 0x50, 0x98, 0x2e, 0x50, 0xb1, 0xf1, 0x6f, 0x05, 0x2e,
+    0x5b, 0x00, 0x01, 0x2e, 0x5a, 0x00, 0x23, 0xbd, 0x46, 0x86, 0x10, 0x0a, 0x40, 0x42, 0xf3, 0x7f, 0x7f, 0x98, 0x2e,
     0xf6, 0x01, 0x05, 0x2e, 0x02, 0x01, 0xf0, 0x6f, 0x03, 0x2e, 0x96, 0x00, 0x2e, 0xbd, 0x2e, 0xb9, 0x01, 0x42, 0x0b,
     0x30, 0x3a, 0x82, 0x37, 0x2e, 0x96, 0x00, 0x80, 0x90, 0x9f, 0x2f, 0x10, 0x30, 0x21, 0x2e, 0x5f, 0xf0, 0x9c, 0x2d,
     0x01, 0x2e, 0x01, 0x01, 0x03, 0x2e, 0x00, 0x01, 0x82, 0xbd, 0x01, 0xbd, 0x94, 0xbc, 0xbf, 0xb9, 0x2f, 0xb9, 0x9f,
     0xb8, 0x40, 0xb2, 0x0f, 0xb8, 0x9a, 0x0a, 0x50, 0x0a, 0x10, 0x30, 0x01, 0x2f, 0x40, 0x90, 0x01, 0x2f, 0x00, 0x30,
     0xb8, 0x2e, 0xb8, 0x2e, 0x30, 0x50, 0x00, 0x30, 0x3b, 0x56, 0x05, 0x30, 0x05, 0x2c, 0xfb, 0x7f, 0x3e, 0xbe, 0xd2,
     0xba, 0xb2, 0xb9, 0x6c, 0x0b, 0x53, 0x0e, 0xf9, 0x2f, 0x53, 0x1a, 0x01, 0x2f, 0x4d, 0x0e, 0xf5, 0x2f, 0xd2, 0x7f,
-    0x04, 0x30, 0x1f, 0x2c, 0xe1, 0x7f, 0xc5, 0x01, 0xa3, 0x03, 0x72, 0x0e, 0x03, 0x2f, 0x72, 0x1a, 0x0f, 0x2f, 0x79,
-    0x0f, 0x0d, 0x2f, 0xe1, 0x6f, 0x4f, 0x04, 0x5f, 0xb9, 0xb1, 0xbf, 0xfa, 0x0b, 0xd2, 0x6f, 0x96, 0x06, 0xb1, 0x25,
-    0x51, 0xbf, 0xeb, 0x7f, 0x06, 0x00, 0xb2, 0x25, 0x27, 0x03, 0xdb, 0x7f, 0xcf, 0xbf, 0x3e, 0xbf, 0x01, 0xb8, 0xd2,
-    0xba, 0x41, 0xba, 0xb2, 0xb9, 0x07, 0x0a, 0x6e, 0x0b, 0xc0, 0x90, 0xdf, 0x2f, 0x40, 0x91, 0xdd, 0x2f, 0xfb, 0x6f,
-    0xd0, 0x5f, 0xb8, 0x2e, 0x10, 0x50, 0xfb, 0x7f, 0x21, 0x25, 0x98, 0x2e, 0xdf, 0xb0, 0xfb, 0x6f, 0x21, 0x25, 0xf0,
-    0x5f, 0x10, 0x25, 0x80, 0x2e, 0x9b, 0xb0, 0x83, 0x86, 0x01, 0x30, 0x00, 0x30, 0x94, 0x40, 0x24, 0x18, 0x06, 0x00,
-    0x53, 0x0e, 0x4f, 0x02, 0xf9, 0x2f, 0xb8, 0x2e, 0x03, 0x30, 0x15, 0x40, 0xd9, 0x04, 0x2b, 0x0e, 0x1d, 0x23, 0x29,
-    0x0f, 0x15, 0x40, 0x0c, 0x23, 0x2b, 0x0e, 0x9d, 0x23, 0x29, 0x0f, 0x4e, 0x23, 0x00, 0x40, 0x03, 0x0e, 0xd8, 0x22,
-    0x01, 0x0f, 0x94, 0x42, 0x4b, 0x22, 0x95, 0x42, 0x81, 0x42, 0xb8, 0x2e, 0x49, 0x50, 0x41, 0x30, 0x02, 0x40, 0x51,
-    0x0a, 0x01, 0x42, 0x18, 0x82, 0x3d, 0x50, 0x60, 0x42, 0x70, 0x3c, 0x3f, 0x54, 0x42, 0x42, 0x69, 0x82, 0x82, 0x32,
-    0x43, 0x40, 0x18, 0x08, 0x02, 0x0a, 0x40, 0x42, 0x42, 0x80, 0x02, 0x3f, 0x01, 0x40, 0x10, 0x50, 0x4a, 0x08, 0xfb,
-    0x7f, 0x11, 0x42, 0x0b, 0x31, 0x0b, 0x42, 0x3e, 0x80, 0xf1, 0x30, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x40, 0xf0,
-    0x1e, 0xb2, 0x01, 0x2f, 0x1a, 0x90, 0x20, 0x2f, 0x03, 0x30, 0x43, 0x50, 0x41, 0x54, 0xf4, 0x34, 0x06, 0x30, 0x47,
-    0x52, 0xf5, 0x32, 0x1d, 0x1a, 0xe3, 0x22, 0x18, 0x1a, 0x45, 0x58, 0xe3, 0x22, 0x04, 0x30, 0xd5, 0x40, 0xb5, 0x0d,
-    0xe1, 0xbe, 0x6f, 0xbb, 0x80, 0x91, 0xa9, 0x0d, 0x01, 0x89, 0xb5, 0x23, 0x10, 0xa1, 0xf7, 0x2f, 0xda, 0x0e, 0xf4,
-    0x34, 0xeb, 0x2f, 0x01, 0x2e, 0x2f, 0x00, 0x70, 0x1a, 0x00, 0x30, 0x21, 0x30, 0x02, 0x2c, 0x08, 0x22, 0x30, 0x30,
-    0x00, 0xb2, 0x06, 0x2f, 0x21, 0x2e, 0x59, 0xf0, 0x98, 0x2e, 0xf6, 0x01, 0x00, 0x2e, 0x00, 0x2e, 0xd0, 0x2e, 0xfb,
-    0x6f, 0xf0, 0x5f, 0xb8, 0x2e, 0x09, 0x2e, 0x01, 0x01, 0x0b, 0x2e, 0x00, 0x01, 0x42, 0xbd, 0xaf, 0xb9, 0xc1, 0xbc,
-    0x54, 0xbf, 0x1f, 0xb9, 0xef, 0xbb, 0xcf, 0xb8, 0x9a, 0x0b, 0x10, 0x50, 0xc0, 0xb3, 0xb1, 0x0b, 0x6d, 0x2f, 0x80,
-    0xb3, 0x6b, 0x2f, 0x0f, 0x2e, 0x97, 0x00, 0x01, 0x8c, 0xc0, 0x91, 0x11, 0x2f, 0xc1, 0x83, 0x23, 0x2e, 0x97, 0x00,
-    0x00, 0x40, 0x21, 0x2e, 0x5d, 0x00, 0x4d, 0x50, 0x91, 0x41, 0x11, 0x42, 0x01, 0x30, 0x82, 0x41, 0x02, 0x42, 0xf0,
-    0x5f, 0x23, 0x2e, 0x5c, 0x00, 0x23, 0x2e, 0x60, 0x00, 0xb8, 0x2e, 0xd5, 0xbe, 0xc3, 0xbf, 0x55, 0xba, 0xc0, 0xb2,
-    0xf3, 0xba, 0x03, 0x30, 0x07, 0x30, 0x09, 0x2f, 0xf0, 0x7f, 0x00, 0x2e, 0x00, 0x40, 0x0f, 0x2e, 0x5d, 0x00, 0x07,
-    0x04, 0x00, 0xa8, 0xd8, 0x05, 0xc7, 0x23, 0xf0, 0x6f, 0x80, 0xb2, 0x02, 0x30, 0x09, 0x2f, 0xf7, 0x7f, 0x00, 0x2e,
-    0x82, 0x41, 0x0f, 0x2e, 0x5e, 0x00, 0x97, 0x04, 0x80, 0xa8, 0xda, 0x05, 0x97, 0x22, 0xf7, 0x6f, 0x40, 0xb2, 0x09,
-    0x2f, 0x02, 0x82, 0x00, 0x2e, 0x41, 0x40, 0x07, 0x2e, 0x5f, 0x00, 0x4b, 0x04, 0x03, 0x30, 0x40, 0xa8, 0xd9, 0x04,
-    0xcb, 0x22, 0x7c, 0x0f, 0x09, 0x2f, 0x54, 0x0f, 0x07, 0x2f, 0x5c, 0x0f, 0x05, 0x2f, 0x01, 0x30, 0x23, 0x2e, 0x60,
-    0x00, 0x23, 0x2e, 0x5c, 0x00, 0x0a, 0x2d, 0x05, 0x2e, 0x5c, 0x00, 0x11, 0x30, 0x91, 0x28, 0x55, 0x0e, 0x25, 0x2e,
-    0x5c, 0x00, 0x01, 0x2f, 0x23, 0x2e, 0x60, 0x00, 0x03, 0x2e, 0x60, 0x00, 0x40, 0xb2, 0x12, 0x2f, 0x00, 0x40, 0x21,
-    0x2e, 0x5d, 0x00, 0x4d, 0x50, 0x91, 0x41, 0x11, 0x42, 0x21, 0x30, 0x82, 0x41, 0x02, 0x42, 0x00, 0x2e, 0x01, 0x2e,
-    0x96, 0x00, 0x01, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0x03, 0x2d, 0x00, 0x30, 0x21, 0x2e, 0x97, 0x00, 0xf0, 0x5f, 0xb8,
-    0x2e, 0x30, 0x50, 0xfb, 0x7f, 0x98, 0x2e, 0x2a, 0xb3, 0x4f, 0x58, 0x00, 0x2e, 0x10, 0x43, 0x01, 0x43, 0x3a, 0x8b,
-    0x98, 0x2e, 0x54, 0xb2, 0x00, 0x2e, 0x41, 0x41, 0x40, 0xb2, 0x43, 0x2f, 0x04, 0x83, 0x01, 0x2e, 0x66, 0x00, 0x42,
-    0x40, 0x77, 0x82, 0x02, 0x04, 0x00, 0xac, 0x40, 0x42, 0x01, 0x2f, 0x21, 0x2e, 0x62, 0x00, 0x50, 0x40, 0x52, 0x40,
-    0x02, 0x0f, 0x02, 0x30, 0x01, 0x2f, 0x00, 0xac, 0x01, 0x2f, 0x25, 0x2e, 0x62, 0x00, 0x7e, 0x88, 0x06, 0x85, 0x85,
-    0x86, 0xc5, 0x80, 0x41, 0x40, 0x04, 0x41, 0x4c, 0x04, 0x05, 0x8a, 0x82, 0x40, 0xc3, 0x40, 0x04, 0x40, 0xe5, 0x7f,
-    0xd1, 0x7f, 0x98, 0x2e, 0x29, 0xb2, 0xe5, 0x6f, 0x72, 0x83, 0x45, 0x84, 0x85, 0x86, 0xc5, 0x8c, 0xc4, 0x40, 0x83,
-    0x40, 0x42, 0x40, 0xd1, 0x6f, 0x40, 0x43, 0xe6, 0x7f, 0x98, 0x2e, 0x29, 0xb2, 0xe2, 0x6f, 0xd1, 0x6f, 0x80, 0x42,
-    0xb2, 0x84, 0x85, 0x86, 0xc5, 0x88, 0x05, 0x81, 0x82, 0x40, 0xc3, 0x40, 0x04, 0x41, 0xe0, 0x7f, 0x98, 0x2e, 0x29,
-    0xb2, 0xe1, 0x6f, 0x14, 0x30, 0x40, 0x42, 0x98, 0x2e, 0xd7, 0xb2, 0x29, 0x2e, 0x5e, 0xf0, 0xfb, 0x6f, 0xd0, 0x5f,
-    0xb8, 0x2e, 0x01, 0x2e, 0x65, 0x00, 0x15, 0x30, 0xe8, 0x15, 0x06, 0x31, 0x30, 0x8a, 0x8f, 0x0f, 0xb0, 0x05, 0x11,
-    0x2f, 0x40, 0xa4, 0x0d, 0x2f, 0xda, 0x04, 0x46, 0x25, 0x19, 0x18, 0x00, 0xb2, 0x07, 0x2f, 0x10, 0xa0, 0x02, 0x2f,
-    0x00, 0x2e, 0x04, 0x2c, 0xbd, 0x11, 0xf0, 0x12, 0x7c, 0x14, 0x99, 0x0b, 0x96, 0x00, 0x02, 0x25, 0xb8, 0x2e, 0xa3,
-    0x04, 0x4f, 0x04, 0x46, 0x25, 0x00, 0xb2, 0x11, 0x18, 0x07, 0x2f, 0x10, 0xa0, 0x02, 0x2f, 0x00, 0x2e, 0x04, 0x2c,
-    0xbd, 0x11, 0xb0, 0x12, 0x7c, 0x14, 0x91, 0x0b, 0x1e, 0x00, 0xb8, 0x2e, 0x01, 0x2e, 0x02, 0x01, 0x0e, 0xbc, 0x10,
-    0x50, 0x0e, 0xb8, 0xf0, 0x7f, 0x00, 0x2e, 0x01, 0x2e, 0x61, 0x00, 0xf1, 0x6f, 0x01, 0x1a, 0x74, 0x2f, 0xf0, 0x6f,
-    0x03, 0xb2, 0x21, 0x2e, 0x61, 0x00, 0x4e, 0x2f, 0x02, 0xb2, 0x2a, 0x2f, 0x01, 0xb2, 0x06, 0x2f, 0x53, 0x52, 0x00,
-    0x30, 0x50, 0x42, 0x40, 0x42, 0x7e, 0x82, 0x66, 0x2c, 0x40, 0x42, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x03, 0x2f,
-    0x01, 0x2e, 0x95, 0x00, 0x1f, 0x90, 0x07, 0x2f, 0x53, 0x50, 0x31, 0x37, 0x11, 0x42, 0x3e, 0x82, 0x62, 0x30, 0x51,
-    0x56, 0x02, 0x42, 0x43, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x95, 0x00, 0x1a, 0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00,
-    0x1e, 0x90, 0x4b, 0x2f, 0x53, 0x50, 0x61, 0x36, 0x11, 0x42, 0x62, 0x30, 0x51, 0x56, 0x02, 0x42, 0x3e, 0x82, 0x44,
-    0x2c, 0x43, 0x42, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x14, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x10, 0x2f,
-    0x01, 0x2e, 0x95, 0x00, 0x1a, 0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1e, 0x90, 0x32, 0x2f, 0x53, 0x50, 0x21,
-    0x31, 0x11, 0x42, 0x52, 0x30, 0x3e, 0x82, 0x02, 0x42, 0x23, 0x32, 0x2b, 0x2c, 0x43, 0x42, 0x53, 0x50, 0x01, 0x32,
-    0x11, 0x42, 0x52, 0x30, 0x3e, 0x82, 0x02, 0x42, 0x23, 0x32, 0x22, 0x2c, 0x43, 0x42, 0x01, 0x2e, 0x95, 0x00, 0x1f,
-    0xb2, 0x14, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x10, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1a, 0xb2, 0x03, 0x2f,
-    0x01, 0x2e, 0x95, 0x00, 0x1e, 0x90, 0x10, 0x2f, 0x53, 0x50, 0xa1, 0x30, 0x11, 0x42, 0x42, 0x30, 0x3e, 0x82, 0x02,
-    0x42, 0x13, 0x31, 0x09, 0x2c, 0x43, 0x42, 0x53, 0x50, 0x61, 0x31, 0x11, 0x42, 0x3e, 0x82, 0x42, 0x30, 0x13, 0x31,
-    0x02, 0x42, 0x43, 0x42, 0xf0, 0x5f, 0xb8, 0x2e, 0x55, 0x50, 0x57, 0x52, 0x12, 0x40, 0x52, 0x42, 0xa8, 0xb5, 0x12,
-    0x40, 0x53, 0x42, 0x42, 0x42, 0x42, 0x82, 0x00, 0x40, 0x88, 0xb5, 0x50, 0x42, 0x43, 0x42, 0x7e, 0x80, 0xa8, 0xb4,
-    0x01, 0x42, 0xb8, 0x2e, 0x5b, 0x52, 0x10, 0x50, 0x52, 0x40, 0xfb, 0x7f, 0x44, 0x80, 0x4b, 0x40, 0x12, 0x42, 0x0b,
-    0x42, 0x37, 0x80, 0x05, 0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80, 0x05, 0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80,
-    0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x77, 0x80, 0x00, 0x2e, 0x11, 0x40, 0x04, 0x84, 0x0b, 0x40, 0x91, 0x42, 0xb7,
-    0x80, 0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x7c, 0x80, 0x8b, 0x42, 0x05, 0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80,
-    0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x7c, 0x8c, 0x98, 0x2e, 0x2a, 0xb3, 0x59, 0x54, 0x90, 0x43, 0x81, 0x43, 0xbc,
-    0x83, 0xa0, 0x40, 0x83, 0x8a, 0x83, 0x40, 0x08, 0xbe, 0x62, 0x41, 0x40, 0x41, 0x43, 0x8b, 0x23, 0x0b, 0x28, 0xbd,
-    0x63, 0x41, 0x10, 0x0a, 0x54, 0x42, 0xb8, 0xbd, 0x42, 0x41, 0x50, 0x42, 0x1a, 0x0a, 0xfb, 0x6f, 0xc0, 0x2e, 0x40,
-    0x42, 0xf0, 0x5f, 0x5d, 0x52, 0x00, 0x2e, 0x64, 0x40, 0x51, 0x25, 0x62, 0x40, 0x40, 0x40, 0x00, 0xb2, 0xa8, 0xb8,
-    0xa8, 0xbd, 0x61, 0x0a, 0x18, 0x0a, 0x00, 0x2f, 0xb8, 0x2e, 0x45, 0x41, 0x40, 0x91, 0x06, 0x2f, 0x05, 0x2e, 0x28,
-    0xf0, 0x22, 0x1a, 0x4c, 0x22, 0xc0, 0x2e, 0xf2, 0x3f, 0x02, 0x22, 0x15, 0x1a, 0x3f, 0x58, 0xc0, 0x2e, 0x9c, 0x0a,
-    0x02, 0x22, 0x03, 0x2e, 0x98, 0x00, 0x41, 0x80, 0xa0, 0x50, 0x00, 0x40, 0x2a, 0x25, 0xb6, 0x84, 0x83, 0xbd, 0xbf,
-    0xb9, 0x02, 0xbe, 0x83, 0x42, 0x4f, 0xba, 0x81, 0xbe, 0xf2, 0x7f, 0x5f, 0xb9, 0x74, 0x7f, 0x8f, 0xb9, 0x82, 0x7f,
-    0xc0, 0xb2, 0xeb, 0x7f, 0x02, 0x30, 0x90, 0x2e, 0xe1, 0xb3, 0x63, 0x6f, 0xc0, 0x90, 0x05, 0x2f, 0x73, 0x6f, 0xc0,
-    0x90, 0x02, 0x2f, 0x83, 0x6f, 0xc0, 0xb2, 0x7a, 0x2f, 0x07, 0x2e, 0x7a, 0x00, 0xc0, 0x90, 0x5f, 0x58, 0x63, 0x5a,
-    0x07, 0x2f, 0x5f, 0x5c, 0x00, 0x2e, 0x92, 0x43, 0x75, 0x0e, 0xfc, 0x2f, 0xc1, 0x86, 0x27, 0x2e, 0x7a, 0x00, 0x43,
-    0x40, 0xb1, 0xbd, 0x42, 0x82, 0xb1, 0xb9, 0x04, 0xbc, 0x04, 0xb8, 0x41, 0x40, 0xb3, 0x7f, 0x18, 0x04, 0x94, 0xbc,
-    0xa2, 0x7f, 0xc2, 0x7f, 0xd2, 0x7f, 0x94, 0xb8, 0x61, 0x56, 0x12, 0x30, 0x25, 0x5a, 0xf6, 0x6f, 0x95, 0x7f, 0x00,
-    0x2e, 0x97, 0x41, 0xc0, 0x91, 0x07, 0x30, 0xf6, 0x7f, 0x02, 0x2f, 0x00, 0x2e, 0x3b, 0x2c, 0x07, 0x43, 0x46, 0x41,
-    0x80, 0xa9, 0xfe, 0x05, 0xf7, 0x23, 0x05, 0x41, 0x40, 0xb3, 0x28, 0x2f, 0xcb, 0x40, 0xf8, 0x0e, 0x05, 0x2f, 0x80,
-    0xa1, 0x06, 0x30, 0x96, 0x23, 0x7b, 0x25, 0x3e, 0x1a, 0x02, 0x2f, 0x05, 0x30, 0x28, 0x2c, 0x05, 0x43, 0x6a, 0x29,
-    0x05, 0x43, 0xe9, 0x0e, 0x22, 0x2f, 0xc5, 0x6f, 0x40, 0x91, 0x1f, 0x2f, 0xd6, 0x6f, 0xa4, 0x7f, 0x5b, 0x25, 0x16,
-    0x15, 0xd3, 0xbe, 0xc4, 0x7f, 0x2c, 0x0b, 0x5f, 0x5a, 0xae, 0x01, 0x63, 0x5e, 0x0b, 0x30, 0x2e, 0x1a, 0x00, 0x2f,
-    0x4b, 0x43, 0x41, 0x8b, 0x29, 0x2e, 0x7b, 0x00, 0x6f, 0x0e, 0xf7, 0x2f, 0xa4, 0x6f, 0x0b, 0x2c, 0xa2, 0x7f, 0xb5,
-    0x6f, 0xfd, 0x0e, 0x06, 0x2f, 0x96, 0x6f, 0x02, 0x43, 0x05, 0x30, 0x86, 0x41, 0x80, 0xa1, 0x55, 0x23, 0xc5, 0x42,
-    0x01, 0x89, 0xd5, 0x6f, 0x41, 0x8d, 0x95, 0x6f, 0x41, 0x8b, 0xc1, 0x86, 0x83, 0xa3, 0xd6, 0x7f, 0xb1, 0x2f, 0xa0,
-    0x6f, 0x00, 0xb2, 0x05, 0x2f, 0x01, 0x2e, 0x96, 0x00, 0x41, 0x30, 0x01, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0xf1, 0x30,
-    0x01, 0x2e, 0x7b, 0x00, 0x07, 0x2c, 0x01, 0x08, 0x01, 0x2e, 0x7b, 0x00, 0xf1, 0x30, 0x01, 0x08, 0x25, 0x2e, 0x7a,
-    0x00, 0xeb, 0x6f, 0x60, 0x5f, 0xb8, 0x2e, 0x03, 0x2e, 0x99, 0x00, 0x41, 0x80, 0x40, 0x50, 0x00, 0x40, 0x03, 0xbd,
-    0x2f, 0xb9, 0xfb, 0x7f, 0x80, 0xb2, 0x0b, 0x30, 0x39, 0x2f, 0x05, 0x2e, 0x82, 0x00, 0x80, 0x90, 0x04, 0x2f, 0x81,
-    0x84, 0x25, 0x2e, 0x82, 0x00, 0x37, 0x2e, 0x83, 0x00, 0x42, 0x86, 0x42, 0x40, 0xc1, 0x40, 0xa1, 0xbd, 0x04, 0xbd,
-    0x24, 0xb9, 0xe2, 0x7f, 0x94, 0xbc, 0x14, 0xb8, 0xc0, 0x7f, 0xb1, 0xb9, 0x1f, 0x52, 0xd3, 0x7f, 0x98, 0x2e, 0xd4,
-    0xb0, 0xe2, 0x6f, 0xd1, 0x6f, 0x8a, 0x28, 0x42, 0x0f, 0x0d, 0x2f, 0xc1, 0x0e, 0x05, 0x2e, 0x83, 0x00, 0x13, 0x30,
-    0x13, 0x28, 0x04, 0x2f, 0x80, 0xa6, 0x08, 0x2f, 0x21, 0x2e, 0x83, 0x00, 0x06, 0x2d, 0x21, 0x2e, 0x83, 0x00, 0x03,
-    0x2d, 0x00, 0x30, 0x21, 0x2e, 0x83, 0x00, 0x03, 0x2e, 0x83, 0x00, 0xc0, 0x6f, 0xc8, 0x0e, 0x08, 0x2f, 0x01, 0x2e,
-    0x96, 0x00, 0x81, 0x30, 0x01, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0x02, 0x2d, 0x37, 0x2e, 0x82, 0x00, 0xfb, 0x6f, 0xc0,
-    0x5f, 0xb8, 0x2e, 0x03, 0x2e, 0x9a, 0x00, 0x53, 0x40, 0x41, 0x40, 0x3b, 0xb9, 0x65, 0x58, 0x10, 0x50, 0x0c, 0x09,
-    0x80, 0xb2, 0x06, 0x30, 0x64, 0x2f, 0x00, 0xb3, 0x62, 0x2f, 0x09, 0x2e, 0x84, 0x00, 0x01, 0x84, 0x00, 0x91, 0x0e,
-    0x2f, 0x01, 0x83, 0x23, 0x2e, 0x84, 0x00, 0x00, 0x40, 0x21, 0x2e, 0x86, 0x00, 0x6f, 0x50, 0x91, 0x40, 0x11, 0x42,
-    0xf0, 0x5f, 0x81, 0x40, 0x01, 0x42, 0x2d, 0x2e, 0x85, 0x00, 0xb8, 0x2e, 0x69, 0x58, 0x0c, 0x09, 0x00, 0xb3, 0x67,
-    0x5a, 0xdd, 0x08, 0x04, 0x30, 0x06, 0x2f, 0x04, 0x40, 0x0b, 0x2e, 0x86, 0x00, 0x25, 0x05, 0x00, 0xa9, 0x74, 0x05,
-    0x25, 0x23, 0x3b, 0x5a, 0x4d, 0x09, 0x40, 0xb3, 0x07, 0x2f, 0x85, 0x40, 0x0d, 0x2e, 0x87, 0x00, 0x6e, 0x05, 0x06,
-    0x30, 0x40, 0xa9, 0xb5, 0x05, 0xae, 0x23, 0x6b, 0x5a, 0x4d, 0x09, 0x40, 0xb3, 0x05, 0x30, 0x07, 0x30, 0x0a, 0x2f,
-    0x02, 0x8e, 0xf6, 0x7f, 0x00, 0x2e, 0xc6, 0x41, 0x0f, 0x2e, 0x88, 0x00, 0xb7, 0x05, 0x80, 0xa9, 0xee, 0x05, 0xf7,
-    0x23, 0xf6, 0x6f, 0x63, 0x0f, 0x03, 0x2f, 0x73, 0x0f, 0x01, 0x2f, 0xfb, 0x0e, 0x02, 0x2f, 0x2b, 0x2e, 0x85, 0x00,
-    0x0a, 0x2d, 0x09, 0x2e, 0x85, 0x00, 0x13, 0x30, 0x6d, 0x5c, 0x23, 0x29, 0x4e, 0x08, 0xe1, 0x0f, 0x29, 0x2e, 0x85,
-    0x00, 0x5d, 0x23, 0x00, 0x40, 0x21, 0x2e, 0x86, 0x00, 0x6f, 0x50, 0x91, 0x40, 0x11, 0x42, 0x40, 0xb3, 0x81, 0x40,
-    0x01, 0x42, 0x08, 0x2f, 0x00, 0x32, 0x03, 0x2e, 0x96, 0x00, 0x08, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0x02, 0x2d, 0x2d,
-    0x2e, 0x84, 0x00, 0xf0, 0x5f, 0xb8, 0x2e, 0x30, 0x50, 0x42, 0x80, 0x42, 0x40, 0xf1, 0x7f, 0xe0, 0x7f, 0xdb, 0x7f,
-    0x02, 0x25, 0x71, 0x52, 0x98, 0x2e, 0xe9, 0xb0, 0xe2, 0x6f, 0x00, 0x2e, 0xa1, 0x40, 0xa0, 0x40, 0x82, 0x40, 0x82,
-    0x86, 0x94, 0x40, 0x24, 0x18, 0x82, 0x40, 0x46, 0x25, 0x57, 0x25, 0x12, 0x18, 0xa6, 0x00, 0x2f, 0x03, 0xc3, 0x40,
-    0x1b, 0x18, 0x57, 0x25, 0xaa, 0xb9, 0x46, 0x18, 0x46, 0xbe, 0x94, 0xbc, 0xe8, 0x18, 0xe3, 0x0a, 0x19, 0x00, 0x26,
-    0xbd, 0x47, 0x0e, 0x0f, 0x2f, 0x47, 0x1a, 0x01, 0x2f, 0x56, 0x0e, 0x0b, 0x2f, 0x79, 0x00, 0x4b, 0x0e, 0x00, 0x30,
-    0x08, 0x2f, 0x4b, 0x1a, 0x01, 0x2f, 0x72, 0x0e, 0x04, 0x2f, 0xf0, 0x6f, 0x03, 0x80, 0x02, 0x2c, 0x00, 0x40, 0x10,
-    0x30, 0xdb, 0x6f, 0xd0, 0x5f, 0xb8, 0x2e, 0x81, 0x8a, 0x82, 0x88, 0x41, 0xb2, 0x01, 0x2f, 0x00, 0x2e, 0x02, 0x2d,
-    0x24, 0x2c, 0x00, 0x30, 0x42, 0xb2, 0x01, 0x2f, 0x43, 0x90, 0x37, 0x2f, 0x80, 0x40, 0xc6, 0x40, 0x86, 0x05, 0x7e,
-    0x80, 0x73, 0x52, 0xc8, 0x01, 0x00, 0x30, 0x80, 0xa9, 0x46, 0x04, 0xc7, 0x41, 0x71, 0x22, 0x4f, 0x0f, 0x28, 0x2f,
-    0xc1, 0x8c, 0x41, 0x41, 0x86, 0x41, 0x4e, 0x04, 0x40, 0xa8, 0x81, 0x05, 0x4e, 0x22, 0x4f, 0x0f, 0x1f, 0x2f, 0xc2,
-    0x82, 0x03, 0x41, 0x41, 0x40, 0xd9, 0x04, 0xc0, 0xa8, 0x43, 0x04, 0xd9, 0x22, 0x5f, 0x0f, 0x16, 0x2f, 0x82, 0x40,
-    0x80, 0xa8, 0xc2, 0x04, 0x93, 0x22, 0x75, 0x56, 0x53, 0x0f, 0x0d, 0x2f, 0x42, 0x41, 0x80, 0xa8, 0xc2, 0x04, 0x93,
-    0x22, 0x75, 0x56, 0x53, 0x0f, 0x06, 0x2f, 0x02, 0x41, 0x80, 0xa8, 0xc2, 0x04, 0x93, 0x22, 0x75, 0x56, 0xd3, 0x0e,
-    0x05, 0x2f, 0x10, 0x30, 0xb8, 0x2e, 0x10, 0x30, 0xb8, 0x2e, 0x00, 0x30, 0xb8, 0x2e, 0xb8, 0x2e, 0xc0, 0x2e, 0x21,
-    0x2e, 0x9b, 0x00, 0x09, 0x2e, 0x9b, 0x00, 0x05, 0x41, 0x5f, 0xbd, 0xe0, 0x50, 0x2f, 0xb9, 0xf1, 0x7f, 0x80, 0xb2,
-    0xeb, 0x7f, 0x90, 0x2e, 0x09, 0xb6, 0x52, 0x40, 0x54, 0xbc, 0xd1, 0x7f, 0x8a, 0xbb, 0x50, 0x40, 0x03, 0x30, 0xc7,
-    0x7f, 0x7e, 0x8e, 0x80, 0xa8, 0x9a, 0x05, 0x96, 0x22, 0xb7, 0x7f, 0x00, 0xa8, 0xd8, 0x05, 0x07, 0x22, 0xdc, 0xbf,
-    0x01, 0x89, 0xfe, 0xbb, 0x77, 0x5c, 0x41, 0x40, 0xf7, 0x01, 0x04, 0x41, 0x99, 0x05, 0x45, 0xbe, 0xc5, 0xb9, 0x40,
-    0xa8, 0xc4, 0x41, 0x4e, 0x22, 0xd3, 0x05, 0x27, 0x2a, 0xa1, 0x7f, 0x4e, 0x16, 0x17, 0x30, 0x4f, 0x08, 0xb1, 0x01,
-    0xda, 0xbc, 0xde, 0xbe, 0x61, 0xb7, 0xdf, 0xba, 0x9e, 0xb8, 0x86, 0x0f, 0x05, 0x2f, 0xf7, 0x6f, 0x00, 0x2e, 0xc7,
-    0x41, 0xc0, 0xad, 0x17, 0x30, 0x28, 0x2f, 0x86, 0x0f, 0x04, 0x2f, 0xf6, 0x6f, 0x00, 0x2e, 0x86, 0x41, 0x80, 0xa1,
-    0x1d, 0x2f, 0x22, 0x2a, 0x8e, 0x16, 0x14, 0x30, 0x94, 0x08, 0xb2, 0x00, 0x21, 0xb5, 0x93, 0x28, 0x82, 0x0e, 0x04,
-    0x2f, 0xd3, 0x6f, 0x00, 0x2e, 0xc3, 0x40, 0xc0, 0xa0, 0x0a, 0x2f, 0x82, 0x0e, 0x0b, 0x2f, 0xd2, 0x6f, 0x00, 0x2e,
-    0x82, 0x40, 0x80, 0xa0, 0x06, 0x2f, 0x02, 0x30, 0x25, 0x2e, 0x8c, 0x00, 0x03, 0x2d, 0x22, 0x30, 0x25, 0x2e, 0x8c,
-    0x00, 0x07, 0x2c, 0x17, 0x30, 0x32, 0x30, 0x25, 0x2e, 0x8c, 0x00, 0x02, 0x2d, 0x2f, 0x2e, 0x8c, 0x00, 0x40, 0xb3,
-    0x01, 0x2e, 0x8b, 0x00, 0xf2, 0x6f, 0x12, 0x2f, 0xa3, 0x6f, 0x7b, 0x58, 0x5c, 0x0f, 0x03, 0x2f, 0x82, 0xb9, 0x27,
-    0x2e, 0x8d, 0x00, 0x0b, 0x2d, 0x82, 0x86, 0x00, 0x2e, 0xc3, 0x40, 0xc0, 0xac, 0x02, 0x2f, 0x2f, 0x2e, 0x8d, 0x00,
-    0x03, 0x2d, 0x03, 0x30, 0x27, 0x2e, 0x8d, 0x00, 0x09, 0x2e, 0x8c, 0x00, 0x35, 0x30, 0x07, 0x2e, 0x8d, 0x00, 0x25,
-    0x09, 0xb2, 0xbd, 0x23, 0x0b, 0x04, 0x1a, 0x29, 0x2e, 0x8e, 0x00, 0x00, 0x30, 0x2e, 0x2f, 0x40, 0xa4, 0x2c, 0x2f,
-    0x43, 0x90, 0x03, 0x30, 0x0f, 0x2f, 0x0b, 0x2e, 0x94, 0x00, 0x10, 0x30, 0xe8, 0x29, 0x0b, 0x2e, 0x92, 0x00, 0x2c,
-    0x1a, 0x2f, 0x2e, 0x94, 0x00, 0x01, 0x2f, 0x27, 0x2e, 0x94, 0x00, 0x09, 0x2e, 0x94, 0x00, 0x05, 0xa3, 0x03, 0x22,
-    0x00, 0x90, 0x04, 0x2f, 0x79, 0x56, 0x98, 0x2e, 0xe1, 0xb4, 0xf2, 0x6f, 0x03, 0x30, 0x00, 0x90, 0x10, 0x2f, 0x01,
-    0x2e, 0x93, 0x00, 0x62, 0x7f, 0x1a, 0x25, 0xc2, 0x6f, 0x72, 0x7f, 0x83, 0x7f, 0x76, 0x82, 0x90, 0x7f, 0x98, 0x2e,
-    0xa8, 0xb4, 0x01, 0xb2, 0x21, 0x2e, 0x93, 0x00, 0x11, 0x30, 0x02, 0x30, 0x0a, 0x22, 0x03, 0x2e, 0x8e, 0x00, 0x23,
-    0x2e, 0x92, 0x00, 0x01, 0x90, 0x03, 0x2e, 0x8b, 0x00, 0x01, 0x2f, 0x23, 0x2e, 0x8e, 0x00, 0x05, 0x2e, 0x8e, 0x00,
-    0x11, 0x1a, 0x05, 0x2f, 0x03, 0x2e, 0x96, 0x00, 0x02, 0x31, 0x4a, 0x0a, 0x23, 0x2e, 0x96, 0x00, 0xb2, 0x6f, 0x79,
-    0x52, 0x90, 0x40, 0x50, 0x42, 0x00, 0x2e, 0x90, 0x40, 0x50, 0x42, 0x00, 0x2e, 0x82, 0x40, 0x42, 0x42, 0x00, 0x2e,
-    0x01, 0x2e, 0x8e, 0x00, 0x21, 0x2e, 0x8b, 0x00, 0x02, 0x2d, 0x01, 0x2e, 0x8e, 0x00, 0xeb, 0x6f, 0x20, 0x5f, 0xb8,
-    0x2e, 0x60, 0x50, 0x03, 0x2e, 0x0e, 0x01, 0xe0, 0x7f, 0xf1, 0x7f, 0xdb, 0x7f, 0x30, 0x30, 0x7d, 0x54, 0x0a, 0x1a,
-    0x28, 0x2f, 0x1a, 0x25, 0x7a, 0x82, 0x00, 0x30, 0x43, 0x30, 0x32, 0x30, 0x05, 0x30, 0x04, 0x30, 0xf6, 0x6f, 0xf2,
-    0x09, 0xfc, 0x13, 0xc2, 0xab, 0xb3, 0x09, 0xef, 0x23, 0x80, 0xb3, 0xe6, 0x6f, 0xb7, 0x01, 0x00, 0x2e, 0x8b, 0x41,
-    0x4b, 0x42, 0x03, 0x2f, 0x46, 0x40, 0x86, 0x17, 0x81, 0x8d, 0x46, 0x42, 0x41, 0x8b, 0x23, 0xbd, 0xb3, 0xbd, 0x03,
-    0x89, 0x41, 0x82, 0x07, 0x0c, 0x43, 0xa3, 0xe6, 0x2f, 0xe1, 0x6f, 0xa2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xb2, 0x6f,
-    0x52, 0x42, 0x00, 0x2e, 0xc2, 0x6f, 0x42, 0x42, 0x03, 0xb2, 0x06, 0x2f, 0x01, 0x2e, 0x59, 0xf0, 0x01, 0x32, 0x01,
-    0x0a, 0x21, 0x2e, 0x59, 0xf0, 0x06, 0x2d, 0x01, 0x2e, 0x59, 0xf0, 0xf1, 0x3d, 0x01, 0x08, 0x21, 0x2e, 0x59, 0xf0,
-    0xdb, 0x6f, 0xa0, 0x5f, 0xb8, 0x2e, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e,
-    0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80,
-    0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00,
-    0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18, 0x00, 0x80, 0x2e, 0x18,
-    0x00, 0x80, 0x2e, 0x18, 0x00, 0xfd, 0x2d
+    0x04, 0x30, 0x1f, 0x2c, 0xe1, 0x7f, 0xc5, 0x01, 0xa3, 0x03, 0x72, 0x0e, 0x7f, 0x03, 0x2f, 0x72, 0x1a, 0x0f, 0x2f,
+    0x79, 0x0f, 0x0d, 0x2f, 0xe1, 0x6f, 0x4f, 0x04, 0x5f, 0xb9, 0xb1, 0xbf, 0xfa, 0x0b, 0xd2, 0x6f, 0x96, 0x06, 0xb1,
+    0x25, 0x51, 0xbf, 0xeb, 0x7f, 0x06, 0x00, 0xb2, 0x25, 0x27, 0x03, 0xdb, 0x7f, 0xcf, 0xbf, 0x3e, 0xbf, 0x01, 0xb8,
+    0xd2, 0xba, 0x41, 0xba, 0xb2, 0xb9, 0x07, 0x0a, 0x6e, 0x0b, 0xc0, 0x90, 0xdf, 0x2f, 0x40, 0x91, 0xdd, 0x2f, 0xfb,
+    0x6f, 0xd0, 0x5f, 0xb8, 0x2e, 0x10, 0x50, 0xfb, 0x7f, 0x21, 0x25, 0x98, 0x2e, 0xdf, 0xb0, 0xfb, 0x6f, 0x21, 0x25,
+    0xf0, 0x5f, 0x10, 0x25, 0x80, 0x2e, 0x9b, 0xb0, 0x83, 0x86, 0x01, 0x30, 0x00, 0x30, 0x94, 0x40, 0x24, 0x18, 0x06,
+    0x00, 0x53, 0x0e, 0x4f, 0x02, 0xf9, 0x2f, 0xb8, 0x2e, 0x03, 0x30, 0x15, 0x40, 0xd9, 0x04, 0x2b, 0x0e, 0x1d, 0x23,
+    0x29, 0x0f, 0x15, 0x40, 0x0c, 0x23, 0x2b, 0x0e, 0x7f, 0x9d, 0x23, 0x29, 0x0f, 0x4e, 0x23, 0x00, 0x40, 0x03, 0x0e,
+    0xd8, 0x22, 0x01, 0x0f, 0x94, 0x42, 0x4b, 0x22, 0x95, 0x42, 0x81, 0x42, 0xb8, 0x2e, 0x49, 0x50, 0x41, 0x30, 0x02,
+    0x40, 0x51, 0x0a, 0x01, 0x42, 0x18, 0x82, 0x3d, 0x50, 0x60, 0x42, 0x70, 0x3c, 0x3f, 0x54, 0x42, 0x42, 0x69, 0x82,
+    0x82, 0x32, 0x43, 0x40, 0x18, 0x08, 0x02, 0x0a, 0x40, 0x42, 0x42, 0x80, 0x02, 0x3f, 0x01, 0x40, 0x10, 0x50, 0x4a,
+    0x08, 0xfb, 0x7f, 0x11, 0x42, 0x0b, 0x31, 0x0b, 0x42, 0x3e, 0x80, 0xf1, 0x30, 0x01, 0x42, 0x00, 0x2e, 0x01, 0x2e,
+    0x40, 0xf0, 0x1e, 0xb2, 0x01, 0x2f, 0x1a, 0x90, 0x20, 0x2f, 0x03, 0x30, 0x43, 0x50, 0x41, 0x54, 0xf4, 0x34, 0x06,
+    0x30, 0x47, 0x52, 0xf5, 0x32, 0x1d, 0x1a, 0xe3, 0x22, 0x18, 0x1a, 0x45, 0x58, 0xe3, 0x22, 0x04, 0x30, 0xd5, 0x40,
+    0xb5, 0x0d, 0xe1, 0xbe, 0x7f, 0x6f, 0xbb, 0x80, 0x91, 0xa9, 0x0d, 0x01, 0x89, 0xb5, 0x23, 0x10, 0xa1, 0xf7, 0x2f,
+    0xda, 0x0e, 0xf4, 0x34, 0xeb, 0x2f, 0x01, 0x2e, 0x2f, 0x00, 0x70, 0x1a, 0x00, 0x30, 0x21, 0x30, 0x02, 0x2c, 0x08,
+    0x22, 0x30, 0x30, 0x00, 0xb2, 0x06, 0x2f, 0x21, 0x2e, 0x59, 0xf0, 0x98, 0x2e, 0xf6, 0x01, 0x00, 0x2e, 0x00, 0x2e,
+    0xd0, 0x2e, 0xfb, 0x6f, 0xf0, 0x5f, 0xb8, 0x2e, 0x09, 0x2e, 0x01, 0x01, 0x0b, 0x2e, 0x00, 0x01, 0x42, 0xbd, 0xaf,
+    0xb9, 0xc1, 0xbc, 0x54, 0xbf, 0x1f, 0xb9, 0xef, 0xbb, 0xcf, 0xb8, 0x9a, 0x0b, 0x10, 0x50, 0xc0, 0xb3, 0xb1, 0x0b,
+    0x6d, 0x2f, 0x80, 0xb3, 0x6b, 0x2f, 0x0f, 0x2e, 0x97, 0x00, 0x01, 0x8c, 0xc0, 0x91, 0x11, 0x2f, 0xc1, 0x83, 0x23,
+    0x2e, 0x97, 0x00, 0x00, 0x40, 0x21, 0x2e, 0x5d, 0x00, 0x4d, 0x50, 0x91, 0x41, 0x11, 0x42, 0x01, 0x30, 0x82, 0x41,
+    0x7f, 0x02, 0x42, 0xf0, 0x5f, 0x23, 0x2e, 0x5c, 0x00, 0x23, 0x2e, 0x60, 0x00, 0xb8, 0x2e, 0xd5, 0xbe, 0xc3, 0xbf,
+    0x55, 0xba, 0xc0, 0xb2, 0xf3, 0xba, 0x03, 0x30, 0x07, 0x30, 0x09, 0x2f, 0xf0, 0x7f, 0x00, 0x2e, 0x00, 0x40, 0x0f,
+    0x2e, 0x5d, 0x00, 0x07, 0x04, 0x00, 0xa8, 0xd8, 0x05, 0xc7, 0x23, 0xf0, 0x6f, 0x80, 0xb2, 0x02, 0x30, 0x09, 0x2f,
+    0xf7, 0x7f, 0x00, 0x2e, 0x82, 0x41, 0x0f, 0x2e, 0x5e, 0x00, 0x97, 0x04, 0x80, 0xa8, 0xda, 0x05, 0x97, 0x22, 0xf7,
+    0x6f, 0x40, 0xb2, 0x09, 0x2f, 0x02, 0x82, 0x00, 0x2e, 0x41, 0x40, 0x07, 0x2e, 0x5f, 0x00, 0x4b, 0x04, 0x03, 0x30,
+    0x40, 0xa8, 0xd9, 0x04, 0xcb, 0x22, 0x7c, 0x0f, 0x09, 0x2f, 0x54, 0x0f, 0x07, 0x2f, 0x5c, 0x0f, 0x05, 0x2f, 0x01,
+    0x30, 0x23, 0x2e, 0x60, 0x00, 0x23, 0x2e, 0x5c, 0x00, 0x0a, 0x2d, 0x05, 0x2e, 0x5c, 0x00, 0x10, 0x11, 0x30, 0x91,
+    0x28, 0x55, 0x0e, 0x25, 0x2e, 0x5c, 0x00, 0x01, 0x2f, 0x23, 0x2e, 0x60, 0x00, 0x03, 0xe0, 0x7f, 0x40, 0xb2, 0x12,
+    0x2f, 0x00, 0x40, 0x21, 0x2e, 0x5d, 0x00, 0x4d, 0x50, 0x91, 0x41, 0x11, 0x42, 0x21, 0x30, 0x82, 0x41, 0x02, 0x42,
+    0x00, 0x2e, 0x01, 0x2e, 0x96, 0x00, 0x01, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0x03, 0x2d, 0x00, 0x30, 0x21, 0x2e, 0x97,
+    0x00, 0xf0, 0x5f, 0xb8, 0x2e, 0x30, 0x50, 0xfb, 0x7f, 0x98, 0x2e, 0x2a, 0xb3, 0x4f, 0x58, 0x00, 0x2e, 0x10, 0x43,
+    0x01, 0x43, 0x3a, 0x8b, 0x98, 0x2e, 0x54, 0xb2, 0x00, 0x2e, 0x41, 0x41, 0x40, 0xb2, 0x43, 0x2f, 0x04, 0x83, 0x01,
+    0x2e, 0x66, 0x00, 0x42, 0x40, 0x77, 0x82, 0x02, 0x04, 0x00, 0xac, 0x40, 0x42, 0x01, 0x2f, 0x21, 0x2e, 0x62, 0x00,
+    0x50, 0x40, 0x52, 0x40, 0x02, 0x0f, 0x02, 0x30, 0x01, 0x2f, 0x00, 0xac, 0x01, 0x2f, 0x25, 0x2e, 0x62, 0x00, 0x7e,
+    0x88, 0x06, 0x85, 0x85, 0x86, 0xc5, 0x80, 0x41, 0x40, 0x04, 0x41, 0x7f, 0x4c, 0x04, 0x05, 0x8a, 0x82, 0x40, 0xc3,
+    0x40, 0x04, 0x40, 0xe5, 0x7f, 0xd1, 0x7f, 0x98, 0x2e, 0x29, 0xb2, 0xe5, 0x6f, 0x72, 0x83, 0x45, 0x84, 0x85, 0x86,
+    0xc5, 0x8c, 0xc4, 0x40, 0x83, 0x40, 0x42, 0x40, 0xd1, 0x6f, 0x40, 0x43, 0xe6, 0x7f, 0x98, 0x2e, 0x29, 0xb2, 0xe2,
+    0x6f, 0xd1, 0x6f, 0x80, 0x42, 0xb2, 0x84, 0x85, 0x86, 0xc5, 0x88, 0x05, 0x81, 0x82, 0x40, 0xc3, 0x40, 0x04, 0x41,
+    0xe0, 0x7f, 0x98, 0x2e, 0x29, 0xb2, 0xe1, 0x6f, 0x14, 0x30, 0x40, 0x42, 0x98, 0x2e, 0xd7, 0xb2, 0x29, 0x2e, 0x5e,
+    0xf0, 0xfb, 0x6f, 0xd0, 0x5f, 0xb8, 0x2e, 0x01, 0x2e, 0x65, 0x00, 0x15, 0x30, 0xe8, 0x15, 0x06, 0x31, 0x30, 0x8a,
+    0x8f, 0x0f, 0xb0, 0x05, 0x11, 0x2f, 0x40, 0xa4, 0x0d, 0x2f, 0xda, 0x04, 0x46, 0x25, 0x19, 0x18, 0x00, 0xb2, 0x07,
+    0x2f, 0x10, 0xa0, 0x02, 0x2f, 0x00, 0x2e, 0x7f, 0x04, 0x2c, 0xbd, 0x11, 0xf0, 0x12, 0x7c, 0x14, 0x99, 0x0b, 0x96,
+    0x00, 0x02, 0x25, 0xb8, 0x2e, 0xa3, 0x04, 0x4f, 0x04, 0x46, 0x25, 0x00, 0xb2, 0x11, 0x18, 0x07, 0x2f, 0x10, 0xa0,
+    0x02, 0x2f, 0x00, 0x2e, 0x04, 0x2c, 0xbd, 0x11, 0xb0, 0x12, 0x7c, 0x14, 0x91, 0x0b, 0x1e, 0x00, 0xb8, 0x2e, 0x01,
+    0x2e, 0x02, 0x01, 0x0e, 0xbc, 0x10, 0x50, 0x0e, 0xb8, 0xf0, 0x7f, 0x00, 0x2e, 0x01, 0x2e, 0x61, 0x00, 0xf1, 0x6f,
+    0x01, 0x1a, 0x74, 0x2f, 0xf0, 0x6f, 0x03, 0xb2, 0x21, 0x2e, 0x61, 0x00, 0x4e, 0x2f, 0x02, 0xb2, 0x2a, 0x2f, 0x01,
+    0xb2, 0x06, 0x2f, 0x53, 0x52, 0x00, 0x30, 0x50, 0x42, 0x40, 0x42, 0x7e, 0x82, 0x66, 0x2c, 0x40, 0x42, 0x01, 0x2e,
+    0x95, 0x00, 0x1f, 0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0x90, 0x07, 0x2f, 0x53, 0x50, 0x31, 0x37, 0x11,
+    0x42, 0x3e, 0x82, 0x7f, 0x62, 0x30, 0x51, 0x56, 0x02, 0x42, 0x43, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x95, 0x00, 0x1a,
+    0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1e, 0x90, 0x4b, 0x2f, 0x53, 0x50, 0x61, 0x36, 0x11, 0x42, 0x62, 0x30,
+    0x51, 0x56, 0x02, 0x42, 0x3e, 0x82, 0x44, 0x2c, 0x43, 0x42, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x14, 0x2f, 0x01,
+    0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x10, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1a, 0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00,
+    0x1e, 0x90, 0x32, 0x2f, 0x53, 0x50, 0x21, 0x31, 0x11, 0x42, 0x52, 0x30, 0x3e, 0x82, 0x02, 0x42, 0x23, 0x32, 0x2b,
+    0x2c, 0x43, 0x42, 0x53, 0x50, 0x01, 0x32, 0x11, 0x42, 0x52, 0x30, 0x3e, 0x82, 0x02, 0x42, 0x23, 0x32, 0x22, 0x2c,
+    0x43, 0x42, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x14, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1f, 0xb2, 0x10, 0x2f, 0x43,
+    0x01, 0x2e, 0x95, 0x00, 0x1a, 0xb2, 0x03, 0x2f, 0x01, 0x2e, 0x95, 0x00, 0x1e, 0x90, 0x10, 0x2f, 0x53, 0x50, 0xa1,
+    0x30, 0x11, 0x42, 0x42, 0x30, 0x3e, 0x82, 0x02, 0x42, 0x13, 0x31, 0x09, 0x2c, 0x43, 0x42, 0x53, 0x50, 0x61, 0x31,
+    0x11, 0x42, 0x3e, 0x82, 0x42, 0x30, 0x13, 0x31, 0x02, 0x42, 0x43, 0x42, 0xf0, 0x5f, 0xb8, 0x2e, 0x55, 0x50, 0x57,
+    0x52, 0x12, 0x40, 0x52, 0x42, 0xa8, 0xb5, 0x12, 0x40, 0x53, 0x42, 0x80, 0x7f, 0x82, 0x00, 0x40, 0x88, 0xb5, 0x50,
+    0x42, 0x43, 0x42, 0x7e, 0x80, 0xa8, 0xb4, 0x01, 0x42, 0xb8, 0x2e, 0x5b, 0x52, 0x10, 0x50, 0x52, 0x40, 0xfb, 0x7f,
+    0x44, 0x80, 0x4b, 0x40, 0x12, 0x42, 0x0b, 0x42, 0x37, 0x80, 0x05, 0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80, 0x05,
+    0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80, 0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x77, 0x80, 0x00, 0x2e, 0x11, 0x40,
+    0x04, 0x84, 0x0b, 0x40, 0x91, 0x42, 0xb7, 0x80, 0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x7c, 0x80, 0x8b, 0x42, 0x05,
+    0x82, 0x0b, 0x40, 0x4b, 0x42, 0x7c, 0x80, 0x05, 0x82, 0x00, 0x40, 0x40, 0x42, 0x7c, 0x8c, 0x98, 0x2e, 0x2a, 0xb3,
+    0x59, 0x54, 0x90, 0x43, 0x81, 0x43, 0xbc, 0x83, 0xa0, 0x40, 0x83, 0x8a, 0x83, 0x40, 0x08, 0xbe, 0x62, 0x41, 0x40,
+    0x41, 0x43, 0x8b, 0x23, 0x0b, 0x28, 0xbd, 0x63, 0x7f, 0x41, 0x10, 0x0a, 0x54, 0x42, 0xb8, 0xbd, 0x42, 0x41, 0x50,
+    0x42, 0x1a, 0x0a, 0xfb, 0x6f, 0xc0, 0x2e, 0x40, 0x42, 0xf0, 0x5f, 0x5d, 0x52, 0x00, 0x2e, 0x64, 0x40, 0x51, 0x25,
+    0x62, 0x40, 0x40, 0x40, 0x00, 0xb2, 0xa8, 0xb8, 0xa8, 0xbd, 0x61, 0x0a, 0x18, 0x0a, 0x00, 0x2f, 0xb8, 0x2e, 0x45,
+    0x41, 0x40, 0x91, 0x06, 0x2f, 0x05, 0x2e, 0x28, 0xf0, 0x22, 0x1a, 0x4c, 0x22, 0xc0, 0x2e, 0xf2, 0x3f, 0x02, 0x22,
+    0x15, 0x1a, 0x3f, 0x58, 0xc0, 0x2e, 0x9c, 0x0a, 0x02, 0x22, 0x03, 0x2e, 0x98, 0x00, 0x41, 0x80, 0xa0, 0x50, 0x00,
+    0x40, 0x2a, 0x25, 0xb6, 0x84, 0x83, 0xbd, 0xbf, 0xb9, 0x02, 0xbe, 0x83, 0x42, 0x4f, 0xba, 0x81, 0xbe, 0xf2, 0x7f,
+    0x5f, 0xb9, 0x74, 0x7f, 0x8f, 0xb9, 0x82, 0x7f, 0xc0, 0xb2, 0xeb, 0x7f, 0x02, 0x30, 0x90, 0x2e, 0xe1, 0xb3, 0x63,
+    0x6f, 0xc0, 0x90, 0x05, 0x7f, 0x2f, 0x73, 0x6f, 0xc0, 0x90, 0x02, 0x2f, 0x83, 0x6f, 0xc0, 0xb2, 0x7a, 0x2f, 0x07,
+    0x2e, 0x7a, 0x00, 0xc0, 0x90, 0x5f, 0x58, 0x63, 0x5a, 0x07, 0x2f, 0x5f, 0x5c, 0x00, 0x2e, 0x92, 0x43, 0x75, 0x0e,
+    0xfc, 0x2f, 0xc1, 0x86, 0x27, 0x2e, 0x7a, 0x00, 0x43, 0x40, 0xb1, 0xbd, 0x42, 0x82, 0xb1, 0xb9, 0x04, 0xbc, 0x04,
+    0xb8, 0x41, 0x40, 0xb3, 0x7f, 0x18, 0x04, 0x94, 0xbc, 0xa2, 0x7f, 0xc2, 0x7f, 0xd2, 0x7f, 0x94, 0xb8, 0x61, 0x56,
+    0x12, 0x30, 0x25, 0x5a, 0xf6, 0x6f, 0x95, 0x7f, 0x00, 0x2e, 0x97, 0x41, 0xc0, 0x91, 0x07, 0x30, 0xf6, 0x7f, 0x02,
+    0x2f, 0x00, 0x2e, 0x3b, 0x2c, 0x07, 0x43, 0x46, 0x41, 0x80, 0xa9, 0xfe, 0x05, 0xf7, 0x23, 0x05, 0x41, 0x40, 0xb3,
+    0x28, 0x2f, 0xcb, 0x40, 0xf8, 0x0e, 0x05, 0x2f, 0x80, 0xa1, 0x06, 0x30, 0x96, 0x23, 0x7b, 0x25, 0x3e, 0x1a, 0x02,
+    0x7f, 0x2f, 0x05, 0x30, 0x28, 0x2c, 0x05, 0x43, 0x6a, 0x29, 0x05, 0x43, 0xe9, 0x0e, 0x22, 0x2f, 0xc5, 0x6f, 0x40,
+    0x91, 0x1f, 0x2f, 0xd6, 0x6f, 0xa4, 0x7f, 0x5b, 0x25, 0x16, 0x15, 0xd3, 0xbe, 0xc4, 0x7f, 0x2c, 0x0b, 0x5f, 0x5a,
+    0xae, 0x01, 0x63, 0x5e, 0x0b, 0x30, 0x2e, 0x1a, 0x00, 0x2f, 0x4b, 0x43, 0x41, 0x8b, 0x29, 0x2e, 0x7b, 0x00, 0x6f,
+    0x0e, 0xf7, 0x2f, 0xa4, 0x6f, 0x0b, 0x2c, 0xa2, 0x7f, 0xb5, 0x6f, 0xfd, 0x0e, 0x06, 0x2f, 0x96, 0x6f, 0x02, 0x43,
+    0x05, 0x30, 0x86, 0x41, 0x80, 0xa1, 0x55, 0x23, 0xc5, 0x42, 0x01, 0x89, 0xd5, 0x6f, 0x41, 0x8d, 0x95, 0x6f, 0x41,
+    0x8b, 0xc1, 0x86, 0x83, 0xa3, 0xd6, 0x7f, 0xb1, 0x2f, 0xa0, 0x6f, 0x00, 0xb2, 0x05, 0x2f, 0x01, 0x2e, 0x96, 0x00,
+    0x41, 0x30, 0x01, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0xf1, 0x30, 0x01, 0x2e, 0x7b, 0x00, 0x07, 0x7f, 0x2c, 0x01, 0x08,
+    0x01, 0x2e, 0x7b, 0x00, 0xf1, 0x30, 0x01, 0x08, 0x25, 0x2e, 0x7a, 0x00, 0xeb, 0x6f, 0x60, 0x5f, 0xb8, 0x2e, 0x03,
+    0x2e, 0x99, 0x00, 0x41, 0x80, 0x40, 0x50, 0x00, 0x40, 0x03, 0xbd, 0x2f, 0xb9, 0xfb, 0x7f, 0x80, 0xb2, 0x0b, 0x30,
+    0x39, 0x2f, 0x05, 0x2e, 0x82, 0x00, 0x80, 0x90, 0x04, 0x2f, 0x81, 0x84, 0x25, 0x2e, 0x82, 0x00, 0x37, 0x2e, 0x83,
+    0x00, 0x42, 0x86, 0x42, 0x40, 0xc1, 0x40, 0xa1, 0xbd, 0x04, 0xbd, 0x24, 0xb9, 0xe2, 0x7f, 0x94, 0xbc, 0x14, 0xb8,
+    0xc0, 0x7f, 0xb1, 0xb9, 0x1f, 0x52, 0xd3, 0x7f, 0x98, 0x2e, 0xd4, 0xb0, 0xe2, 0x6f, 0xd1, 0x6f, 0x8a, 0x28, 0x42,
+    0x0f, 0x0d, 0x2f, 0xc1, 0x0e, 0x05, 0x2e, 0x83, 0x00, 0x13, 0x30, 0x13, 0x28, 0x04, 0x2f, 0x80, 0xa6, 0x08, 0x2f,
+    0x21, 0x2e, 0x83, 0x00, 0x06, 0x2d, 0x21, 0x2e, 0x83, 0x00, 0x03, 0x07, 0x2d, 0x00, 0x30, 0x21, 0x2e, 0x83, 0x00,
+    0x03, 0xe0, 0x7f, 0xc0, 0x6f, 0xc8, 0x0e, 0x08, 0x2f, 0x01, 0x2e, 0x96, 0x00, 0x81, 0x30, 0x01, 0x0a, 0x21, 0x2e,
+    0x96, 0x00, 0x02, 0x2d, 0x37, 0x2e, 0x82, 0x00, 0xfb, 0x6f, 0xc0, 0x5f, 0xb8, 0x2e, 0x03, 0x2e, 0x9a, 0x00, 0x53,
+    0x40, 0x41, 0x40, 0x3b, 0xb9, 0x65, 0x58, 0x10, 0x50, 0x0c, 0x09, 0x80, 0xb2, 0x06, 0x30, 0x64, 0x2f, 0x00, 0xb3,
+    0x62, 0x2f, 0x09, 0x2e, 0x84, 0x00, 0x01, 0x84, 0x00, 0x91, 0x0e, 0x2f, 0x01, 0x83, 0x23, 0x2e, 0x84, 0x00, 0x00,
+    0x40, 0x21, 0x2e, 0x86, 0x00, 0x6f, 0x50, 0x91, 0x40, 0x11, 0x42, 0xf0, 0x5f, 0x81, 0x40, 0x01, 0x42, 0x2d, 0x2e,
+    0x85, 0x00, 0xb8, 0x2e, 0x69, 0x58, 0x0c, 0x09, 0x00, 0xb3, 0x67, 0x5a, 0xdd, 0x08, 0x04, 0x30, 0x06, 0x2f, 0x04,
+    0x40, 0x0b, 0x2e, 0x86, 0x00, 0x25, 0x05, 0x00, 0xa9, 0x74, 0x05, 0x25, 0x23, 0x3b, 0x5a, 0x4d, 0x09, 0x7f, 0x40,
+    0xb3, 0x07, 0x2f, 0x85, 0x40, 0x0d, 0x2e, 0x87, 0x00, 0x6e, 0x05, 0x06, 0x30, 0x40, 0xa9, 0xb5, 0x05, 0xae, 0x23,
+    0x6b, 0x5a, 0x4d, 0x09, 0x40, 0xb3, 0x05, 0x30, 0x07, 0x30, 0x0a, 0x2f, 0x02, 0x8e, 0xf6, 0x7f, 0x00, 0x2e, 0xc6,
+    0x41, 0x0f, 0x2e, 0x88, 0x00, 0xb7, 0x05, 0x80, 0xa9, 0xee, 0x05, 0xf7, 0x23, 0xf6, 0x6f, 0x63, 0x0f, 0x03, 0x2f,
+    0x73, 0x0f, 0x01, 0x2f, 0xfb, 0x0e, 0x02, 0x2f, 0x2b, 0x2e, 0x85, 0x00, 0x0a, 0x2d, 0x09, 0x2e, 0x85, 0x00, 0x13,
+    0x30, 0x6d, 0x5c, 0x23, 0x29, 0x4e, 0x08, 0xe1, 0x0f, 0x29, 0x2e, 0x85, 0x00, 0x5d, 0x23, 0x00, 0x40, 0x21, 0x2e,
+    0x86, 0x00, 0x6f, 0x50, 0x91, 0x40, 0x11, 0x42, 0x40, 0xb3, 0x81, 0x40, 0x01, 0x42, 0x08, 0x2f, 0x00, 0x32, 0x03,
+    0x2e, 0x96, 0x00, 0x08, 0x0a, 0x21, 0x2e, 0x96, 0x00, 0x02, 0x2d, 0x2d, 0x2e, 0x7f, 0x84, 0x00, 0xf0, 0x5f, 0xb8,
+    0x2e, 0x30, 0x50, 0x42, 0x80, 0x42, 0x40, 0xf1, 0x7f, 0xe0, 0x7f, 0xdb, 0x7f, 0x02, 0x25, 0x71, 0x52, 0x98, 0x2e,
+    0xe9, 0xb0, 0xe2, 0x6f, 0x00, 0x2e, 0xa1, 0x40, 0xa0, 0x40, 0x82, 0x40, 0x82, 0x86, 0x94, 0x40, 0x24, 0x18, 0x82,
+    0x40, 0x46, 0x25, 0x57, 0x25, 0x12, 0x18, 0xa6, 0x00, 0x2f, 0x03, 0xc3, 0x40, 0x1b, 0x18, 0x57, 0x25, 0xaa, 0xb9,
+    0x46, 0x18, 0x46, 0xbe, 0x94, 0xbc, 0xe8, 0x18, 0xe3, 0x0a, 0x19, 0x00, 0x26, 0xbd, 0x47, 0x0e, 0x0f, 0x2f, 0x47,
+    0x1a, 0x01, 0x2f, 0x56, 0x0e, 0x0b, 0x2f, 0x79, 0x00, 0x4b, 0x0e, 0x00, 0x30, 0x08, 0x2f, 0x4b, 0x1a, 0x01, 0x2f,
+    0x72, 0x0e, 0x04, 0x2f, 0xf0, 0x6f, 0x03, 0x80, 0x02, 0x2c, 0x00, 0x40, 0x10, 0x30, 0xdb, 0x6f, 0xd0, 0x5f, 0xb8,
+    0x2e, 0x81, 0x8a, 0x82, 0x88, 0x41, 0xb2, 0x01, 0x2f, 0x7b, 0x00, 0x2e, 0x02, 0x2d, 0x24, 0x2c, 0x00, 0x30, 0x42,
+    0xb2, 0x01, 0x2f, 0x43, 0x90, 0x37, 0x2f, 0x80, 0x40, 0xc6, 0x40, 0x86, 0x05, 0x7e, 0x80, 0x73, 0x52, 0xc8, 0x01,
+    0x00, 0x30, 0x80, 0xa9, 0x46, 0x04, 0xc7, 0x41, 0x71, 0x22, 0x4f, 0x0f, 0x28, 0x2f, 0xc1, 0x8c, 0x41, 0x41, 0x86,
+    0x41, 0x4e, 0x04, 0x40, 0xa8, 0x81, 0x05, 0x4e, 0x22, 0x4f, 0x0f, 0x1f, 0x2f, 0xc2, 0x82, 0x03, 0x41, 0x41, 0x40,
+    0xd9, 0x04, 0xc0, 0xa8, 0x43, 0x04, 0xd9, 0x22, 0x5f, 0x0f, 0x16, 0x2f, 0x82, 0x40, 0x80, 0xa8, 0xc2, 0x04, 0x93,
+    0x22, 0x75, 0x56, 0x53, 0x0f, 0x0d, 0x2f, 0x42, 0x41, 0x80, 0xa8, 0xc2, 0x04, 0x93, 0x22, 0x75, 0x56, 0x53, 0x0f,
+    0x06, 0x2f, 0x02, 0x41, 0x80, 0xa8, 0xc2, 0x04, 0x93, 0x22, 0x75, 0x56, 0xd3, 0x0e, 0x05, 0x2f, 0x10, 0x30, 0xb8,
+    0x2e, 0xe1, 0x00, 0x00, 0xe0, 0x08, 0xb8, 0x2e, 0xc0, 0x2e, 0x21, 0x2e, 0x9b, 0x00, 0x09, 0xe0, 0x7f, 0x05, 0x41,
+    0x5f, 0xbd, 0xe0, 0x50, 0x2f, 0xb9, 0xf1, 0x7f, 0x80, 0xb2, 0xeb, 0x7f, 0x90, 0x2e, 0x09, 0xb6, 0x52, 0x40, 0x54,
+    0xbc, 0xd1, 0x7f, 0x8a, 0xbb, 0x50, 0x40, 0x03, 0x30, 0xc7, 0x7f, 0x7e, 0x8e, 0x80, 0xa8, 0x9a, 0x05, 0x96, 0x22,
+    0xb7, 0x7f, 0x00, 0xa8, 0xd8, 0x05, 0x07, 0x22, 0xdc, 0xbf, 0x01, 0x89, 0xfe, 0xbb, 0x77, 0x5c, 0x41, 0x40, 0xf7,
+    0x01, 0x04, 0x41, 0x99, 0x05, 0x45, 0xbe, 0xc5, 0xb9, 0x40, 0xa8, 0xc4, 0x41, 0x4e, 0x22, 0xd3, 0x05, 0x27, 0x2a,
+    0xa1, 0x7f, 0x4e, 0x16, 0x17, 0x30, 0x4f, 0x08, 0xb1, 0x01, 0xda, 0xbc, 0xde, 0xbe, 0x61, 0xb7, 0xdf, 0xba, 0x9e,
+    0xb8, 0x86, 0x0f, 0x05, 0x2f, 0xf7, 0x6f, 0x00, 0x2e, 0xc7, 0x41, 0xc0, 0xad, 0x17, 0x30, 0x28, 0x2f, 0x86, 0x0f,
+    0x04, 0x2f, 0xf6, 0x6f, 0x00, 0x2e, 0x86, 0x41, 0x80, 0xa1, 0x1d, 0x2f, 0x7f, 0x22, 0x2a, 0x8e, 0x16, 0x14, 0x30,
+    0x94, 0x08, 0xb2, 0x00, 0x21, 0xb5, 0x93, 0x28, 0x82, 0x0e, 0x04, 0x2f, 0xd3, 0x6f, 0x00, 0x2e, 0xc3, 0x40, 0xc0,
+    0xa0, 0x0a, 0x2f, 0x82, 0x0e, 0x0b, 0x2f, 0xd2, 0x6f, 0x00, 0x2e, 0x82, 0x40, 0x80, 0xa0, 0x06, 0x2f, 0x02, 0x30,
+    0x25, 0x2e, 0x8c, 0x00, 0x03, 0x2d, 0x22, 0x30, 0x25, 0x2e, 0x8c, 0x00, 0x07, 0x2c, 0x17, 0x30, 0x32, 0x30, 0x25,
+    0x2e, 0x8c, 0x00, 0x02, 0x2d, 0x2f, 0x2e, 0x8c, 0x00, 0x40, 0xb3, 0x01, 0x2e, 0x8b, 0x00, 0xf2, 0x6f, 0x12, 0x2f,
+    0xa3, 0x6f, 0x7b, 0x58, 0x5c, 0x0f, 0x03, 0x2f, 0x82, 0xb9, 0x27, 0x2e, 0x8d, 0x00, 0x0b, 0x2d, 0x82, 0x86, 0x00,
+    0x2e, 0xc3, 0x40, 0xc0, 0xac, 0x02, 0x2f, 0x2f, 0x2e, 0x8d, 0x00, 0x03, 0x2d, 0x03, 0x30, 0x27, 0x2e, 0x8d, 0x00,
+    0x09, 0x2e, 0x8c, 0x00, 0x35, 0x30, 0x07, 0x2e, 0x34, 0x8d, 0x00, 0x25, 0x09, 0xb2, 0xbd, 0x23, 0x0b, 0x04, 0x1a,
+    0x29, 0x2e, 0x8e, 0x00, 0x00, 0x30, 0x2e, 0x2f, 0x40, 0xa4, 0x2c, 0x2f, 0x43, 0x90, 0x03, 0x30, 0x0f, 0x2f, 0x0b,
+    0x2e, 0x94, 0x00, 0x10, 0x30, 0xe8, 0x29, 0x0b, 0x2e, 0x92, 0x00, 0x2c, 0x1a, 0x2f, 0x2e, 0x94, 0x00, 0x01, 0x2f,
+    0x27, 0x2e, 0x94, 0x00, 0x09, 0xe0, 0x4c, 0x05, 0xa3, 0x03, 0x22, 0x00, 0x90, 0x04, 0x2f, 0x79, 0x56, 0x98, 0x2e,
+    0xe1, 0xb4, 0xf2, 0x6f, 0x03, 0x30, 0x00, 0x90, 0x10, 0x2f, 0x01, 0x2e, 0x93, 0x00, 0x62, 0x7f, 0x1a, 0x25, 0xc2,
+    0x6f, 0x72, 0x7f, 0x83, 0x7f, 0x76, 0x82, 0x90, 0x7f, 0x98, 0x2e, 0xa8, 0xb4, 0x01, 0xb2, 0x21, 0x2e, 0x93, 0x00,
+    0x11, 0x30, 0x02, 0x30, 0x0a, 0x22, 0x03, 0x2e, 0x8e, 0x00, 0x23, 0x2e, 0x92, 0x00, 0x01, 0x90, 0x03, 0x2e, 0x8b,
+    0x00, 0x01, 0x2f, 0x23, 0x2e, 0x8e, 0x00, 0x05, 0xe0, 0x7f, 0x11, 0x1a, 0x05, 0x2f, 0x03, 0x2e, 0x96, 0x00, 0x02,
+    0x31, 0x4a, 0x0a, 0x23, 0x2e, 0x96, 0x00, 0xb2, 0x6f, 0x79, 0x52, 0x90, 0x40, 0x50, 0x42, 0x00, 0x2e, 0x90, 0x40,
+    0x50, 0x42, 0x00, 0x2e, 0x82, 0x40, 0x42, 0x42, 0x00, 0x2e, 0x01, 0x2e, 0x8e, 0x00, 0x21, 0x2e, 0x8b, 0x00, 0x02,
+    0x2d, 0x01, 0x2e, 0x8e, 0x00, 0xeb, 0x6f, 0x20, 0x5f, 0xb8, 0x2e, 0x60, 0x50, 0x03, 0x2e, 0x0e, 0x01, 0xe0, 0x7f,
+    0xf1, 0x7f, 0xdb, 0x7f, 0x30, 0x30, 0x7d, 0x54, 0x0a, 0x1a, 0x28, 0x2f, 0x1a, 0x25, 0x7a, 0x82, 0x00, 0x30, 0x43,
+    0x30, 0x32, 0x30, 0x05, 0x30, 0x04, 0x30, 0xf6, 0x6f, 0xf2, 0x09, 0xfc, 0x13, 0xc2, 0xab, 0xb3, 0x09, 0xef, 0x23,
+    0x80, 0xb3, 0xe6, 0x6f, 0xb7, 0x01, 0x00, 0x2e, 0x8b, 0x41, 0x4b, 0x42, 0x03, 0x2f, 0x46, 0x40, 0x86, 0x17, 0x81,
+    0x8d, 0x46, 0x42, 0x41, 0x8b, 0x47, 0x23, 0xbd, 0xb3, 0xbd, 0x03, 0x89, 0x41, 0x82, 0x07, 0x0c, 0x43, 0xa3, 0xe6,
+    0x2f, 0xe1, 0x6f, 0xa2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xb2, 0x6f, 0x52, 0x42, 0x00, 0x2e, 0xc2, 0x6f, 0x42, 0x42,
+    0x03, 0xb2, 0x06, 0x2f, 0x01, 0x2e, 0x59, 0xf0, 0x01, 0x32, 0x01, 0x0a, 0x21, 0x2e, 0x59, 0xf0, 0x06, 0x2d, 0x01,
+    0x2e, 0x59, 0xf0, 0xf1, 0x3d, 0x01, 0x08, 0x21, 0x2e, 0x59, 0xf0, 0xdb, 0x6f, 0xa0, 0x5f, 0xb8, 0x2e, 0x80, 0x2e,
+    0x18, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0x01, 0xfd, 0x2d
 };
 
 /****************************************************************************/
@@ -699,6 +594,7 @@ int8_t bmi088_mma_init(struct bmi08_dev *dev)
 
             /* Assign stream file */
             dev->config_file_ptr = bmi088_mm_config_file;
+            dev->config_file_size = sizeof(bmi088_mm_config_file);
         }
         else
         {
@@ -507,6 +507,9 @@
 #define BMI08_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE UINT8_C(0x02)
 #define BMI08_GYRO_FIFO_1KB_BUFFER UINT16_C(1024)
 
+/**\name   Maximum number of entries in a gyro register write sequence */
+#define BMI08_GYRO_WRITE_SEQ_MAX UINT8_C(8)
+
 /*************************** Common Macros for both Accel and Gyro *****************************/
 /**\name    SPI read/write mask to configure address */
 #define BMI08_SPI_RD_MASK UINT8_C(0x80)
@@ -557,6 +560,23 @@
 
 #define BMI08_CONFIG_STREAM_SIZE UINT16_C(6144)
 
+/**\name    Packed config stream definitions
+ * A packed stream is a list of tokens. A token below 0x80 is followed by
+ * (token + 1) literal bytes. A token of 0x80 or above repeats the bytes
+ * written PERIOD positions earlier, for COUNT + MIN_RUN bytes, so runs
+ * like 0x80, 0x2e, 0x18, 0x00 ... cost one byte. Output beyond the end of
+ * the packed data is zero up to BMI08_CONFIG_STREAM_SIZE.
+ */
+#define BMI08_CONFIG_RLE_REPEAT UINT8_C(0x80)
+#define BMI08_CONFIG_RLE_PERIOD_MASK UINT8_C(0x60)
+#define BMI08_CONFIG_RLE_PERIOD_POS UINT8_C(5)
+#define BMI08_CONFIG_RLE_COUNT_MASK UINT8_C(0x1F)
+#define BMI08_CONFIG_RLE_MIN_RUN UINT8_C(3)
+#define BMI08_CONFIG_RLE_HIST UINT8_C(4)
+
+/*! Largest burst staged in RAM while uploading a packed config stream */
+#define BMI08_CONFIG_BURST_MAX UINT16_C(64)
+
 /**\name    Sensor time array parameter definitions */
 #define BMI08_SENSOR_TIME_MSB_BYTE UINT8_C(2)
 #define BMI08_SENSOR_TIME_XLSB_BYTE UINT8_C(1)
@@ -814,6 +834,66 @@ typedef BMI08_INTF_RET_TYPE (*bmi08_write_fptr_t)(uint8_t reg_addr, const uint8_
  */
 typedef void (*bmi08_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
 
+/*!
+ *  @brief Single register write within a write sequence
+ */
+struct bmi08_reg_write
+{
+    /*! Register address */
+    uint8_t addr;
+
+    /*! Value to be written */
+    uint8_t data;
+};
+
+/*!
+ * @brief Optional bus communication function pointer which submits a list of
+ * single byte register writes as one transport call, e.g. one SPI_IOC_MESSAGE
+ * array with a chip-select toggle per entry or one I2C_RDWR with one message
+ * per entry. The gyro needs 2 us between two register writes in normal mode
+ * and 450 us in suspend mode; the hook owns that spacing between the entries of
+ * a sequence, the driver delays after the last one
+ *
+ * @param[in]     seq      : Register writes, to be issued in order
+ * @param[in]     count    : Number of entries in seq
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval 0 for Success
+ * @retval Non-zero for Failure
+ */
+typedef BMI08_INTF_RET_TYPE (*bmi08_write_seq_fptr_t)(const struct bmi08_reg_write *seq, uint32_t count,
+                                                      void *intf_ptr);
+
+/*!
+ *  @brief Unpacking state of a config stream
+ */
+struct bmi08_config_stream
+{
+    /*! Packed (or plain, when size is 0) config data */
+    const uint8_t *data;
+
+    /*! Size of the packed data, 0 for a plain BMI08_CONFIG_STREAM_SIZE image */
+    uint16_t size;
+
+    /*! Read position in the packed data */
+    uint16_t pos;
+
+    /*! Number of bytes produced so far */
+    uint16_t out;
+
+    /*! Literal bytes left in the current token */
+    uint8_t literal;
+
+    /*! Repeated bytes left in the current token */
+    uint8_t repeat;
+
+    /*! Period of the current repeat token */
+    uint8_t period;
+
+    /*! Last BMI08_CONFIG_RLE_HIST bytes produced, indexed by out */
+    uint8_t hist[BMI08_CONFIG_RLE_HIST];
+};
+
 /**\name    Structure Definitions */
 
 /*!
@@ -1191,6 +1271,10 @@ struct bmi08_dev
     /*! Config stream data buffer address will be assigned */
     const uint8_t *config_file_ptr;
 
+    /*! Size of the packed config stream at config_file_ptr, or 0 when it
+     * points to a plain BMI08_CONFIG_STREAM_SIZE byte image */
+    uint16_t config_file_size;
+
     /*! Max read/write length
      * To be set by the user */
     uint16_t read_write_len;
@@ -1201,6 +1285,10 @@ struct bmi08_dev
     /*! Write function pointer */
     bmi08_write_fptr_t write;
 
+    /*! Optional write sequence function pointer, used for gyro multi-register
+     * writes. Set to NULL to issue one write call per register */
+    bmi08_write_seq_fptr_t write_seq;
+
     /*! Delay function pointer */
     bmi08_delay_us_fptr_t delay_us;
 
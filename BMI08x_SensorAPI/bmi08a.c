@@ -141,8 +141,9 @@ static int8_t set_accel_sync_input(const struct bmi08_accel_int_channel_cfg *int
 /*!
  * @brief This API writes the config stream data in memory using burst mode
  *
- * @param[in] stream_data : Pointer to store data of 32 bytes
- * @param[in] index       : Represents value in multiple of 32 bytes
+ * @param[in] stream_data : Pointer to the burst data
+ * @param[in] len         : Length of the burst in bytes
+ * @param[in] index       : Offset of the burst in the config stream
  * @param[in] dev         : Structure instance of bmi08_dev.
  *
  * @return Result of API execution status
@@ -150,7 +151,7 @@ static int8_t set_accel_sync_input(const struct bmi08_accel_int_channel_cfg *int
  * @retval < 0 -> Fail
  *
  */
-static int8_t stream_transfer_write(const uint8_t *stream_data, uint16_t index, struct bmi08_dev *dev);
+static int8_t stream_transfer_write(const uint8_t *stream_data, uint16_t len, uint16_t index, struct bmi08_dev *dev);
 
 /*!
  * @brief This internal API is used to parse accelerometer data from the FIFO
@@ -393,7 +394,11 @@ int8_t bmi08a_load_config_file(struct bmi08_dev *dev)
     uint8_t aps_disable = BMI08_DISABLE;
 
     uint16_t index = 0;
+    uint16_t len = 0;
+    uint16_t burst_len;
     uint8_t reg_data = 0;
+    uint8_t burst[BMI08_CONFIG_BURST_MAX];
+    struct bmi08_config_stream stream;
 
     /* Check for null pointer in the device structure */
     rslt = dev_null_ptr_check(dev); /* Type-casted to void to address compilation warning */
@@ -427,11 +432,37 @@ int8_t bmi08a_load_config_file(struct bmi08_dev *dev)
 
             if (rslt == BMI08_OK)
             {
-                for (index = 0; index < BMI08_CONFIG_STREAM_SIZE;
-                     index += dev->read_write_len)
+                rslt = bmi08a_config_stream_init(&stream, dev);
+
+                /* A packed stream is unpacked burst by burst, never as a whole */
+                burst_len = dev->read_write_len;
+                if ((dev->config_file_size != 0) && (burst_len > BMI08_CONFIG_BURST_MAX))
                 {
-                    /* Write the config stream */
-                    rslt = stream_transfer_write((dev->config_file_ptr + index), index, dev);
+                    burst_len = BMI08_CONFIG_BURST_MAX;
+                }
+
+                for (index = 0; (index < BMI08_CONFIG_STREAM_SIZE) && (rslt == BMI08_OK); index += len)
+                {
+                    len = BMI08_CONFIG_STREAM_SIZE - index;
+                    if (len > burst_len)
+                    {
+                        len = burst_len;
+                    }
+
+                    if (dev->config_file_size == 0)
+                    {
+                        /* Write the config stream */
+                        rslt = stream_transfer_write((dev->config_file_ptr + index), len, index, dev);
+                    }
+                    else
+                    {
+                        rslt = bmi08a_config_stream_read(&stream, burst, len);
+
+                        if (rslt == BMI08_OK)
+                        {
+                            rslt = stream_transfer_write(burst, len, index, dev);
+                        }
+                    }
                 }
 
                 if (rslt == BMI08_OK)
@@ -475,6 +506,117 @@ int8_t bmi08a_load_config_file(struct bmi08_dev *dev)
     return rslt;
 }
 
+/*!
+ *  @brief This API prepares the unpacking of the config stream assigned to the device.
+ */
+int8_t bmi08a_config_stream_init(struct bmi08_config_stream *stream, const struct bmi08_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = generic_null_ptr_check((void *) stream);
+    rslt |= generic_null_ptr_check((void *) dev);
+
+    if (rslt == BMI08_OK)
+    {
+        rslt = generic_null_ptr_check((void *) dev->config_file_ptr);
+    }
+
+    if (rslt == BMI08_OK)
+    {
+        stream->data = dev->config_file_ptr;
+        stream->size = dev->config_file_size;
+        stream->pos = 0;
+        stream->out = 0;
+        stream->literal = 0;
+        stream->repeat = 0;
+        stream->period = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API unpacks the next bytes of a config stream.
+ */
+int8_t bmi08a_config_stream_read(struct bmi08_config_stream *stream, uint8_t *data, uint16_t len)
+{
+    int8_t rslt;
+    uint16_t idx;
+    uint8_t token;
+    uint8_t value;
+
+    rslt = generic_null_ptr_check((void *) stream);
+    rslt |= generic_null_ptr_check((void *) data);
+
+    if ((rslt == BMI08_OK) && (len > (BMI08_CONFIG_STREAM_SIZE - stream->out)))
+    {
+        rslt = BMI08_E_INVALID_INPUT;
+    }
+
+    for (idx = 0; (idx < len) && (rslt == BMI08_OK) && (stream->size == 0); idx++)
+    {
+        /* Plain image, nothing to unpack */
+        data[idx] = stream->data[stream->out++];
+    }
+
+    for (; (idx < len) && (rslt == BMI08_OK); idx++)
+    {
+        /* Fetch the next token once the current one is used up */
+        if ((stream->literal == 0) && (stream->repeat == 0) && (stream->pos < stream->size))
+        {
+            token = stream->data[stream->pos++];
+            if (token & BMI08_CONFIG_RLE_REPEAT)
+            {
+                stream->period = BMI08_GET_BITS(token, BMI08_CONFIG_RLE_PERIOD) + 1;
+                stream->repeat = BMI08_GET_BITS_POS_0(token, BMI08_CONFIG_RLE_COUNT) + BMI08_CONFIG_RLE_MIN_RUN;
+
+                if (stream->period > stream->out)
+                {
+                    rslt = BMI08_E_CONFIG_STREAM_ERROR;
+                }
+            }
+            else
+            {
+                stream->literal = token + 1;
+            }
+        }
+
+        if (rslt == BMI08_OK)
+        {
+            if (stream->literal != 0)
+            {
+                if (stream->pos < stream->size)
+                {
+                    value = stream->data[stream->pos++];
+                    stream->literal--;
+                }
+                else
+                {
+                    /* Literal cut short by the end of the data */
+                    rslt = BMI08_E_CONFIG_STREAM_ERROR;
+                    value = 0;
+                }
+            }
+            else if (stream->repeat != 0)
+            {
+                value = stream->hist[(stream->out - stream->period) % BMI08_CONFIG_RLE_HIST];
+                stream->repeat--;
+            }
+            else
+            {
+                /* Zero fill after the end of the packed data */
+                value = 0;
+            }
+
+            data[idx] = value;
+            stream->hist[stream->out % BMI08_CONFIG_RLE_HIST] = value;
+            stream->out++;
+        }
+    }
+
+    return rslt;
+}
+
 /*!
  *  @brief This API writes the feature configuration to the accel sensor.
  */
@@ -1767,7 +1909,7 @@ static int8_t set_accel_sync_input(const struct bmi08_accel_int_channel_cfg *int
 /*!
  *  @brief This API writes the config stream data in memory using burst mode.
  */
-static int8_t stream_transfer_write(const uint8_t *stream_data, uint16_t index, struct bmi08_dev *dev)
+static int8_t stream_transfer_write(const uint8_t *stream_data, uint16_t len, uint16_t index, struct bmi08_dev *dev)
 {
     int8_t rslt;
     uint8_t asic_msb = (uint8_t)((index / 2) >> 4);
@@ -1783,11 +1925,7 @@ static int8_t stream_transfer_write(const uint8_t *stream_data, uint16_t index,
         if (rslt == BMI08_OK)
         {
             /* Write to feature config registers */
-            rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_FEATURE_CFG,
-                                       (uint8_t *)stream_data,
-                                       dev->read_write_len,
-                                       dev,
-                                       SET_FUNC);
+            rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_FEATURE_CFG, (uint8_t *)stream_data, len, dev, SET_FUNC);
         }
     }
 
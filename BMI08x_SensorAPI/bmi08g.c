@@ -100,6 +100,34 @@ static int8_t get_regs(uint8_t reg_addr, uint8_t *data, uint32_t len, struct bmi
  */
 static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi08_dev *dev);
 
+/*!
+ *  @brief This API writes a sequence of single byte registers of gyro
+ *  sensor, as one transport call when dev->write_seq is available.
+ *
+ *  @param[in] seq       : Register writes to be issued in order.
+ *  @param[in] count     : No. of entries in seq.
+ *  @param[in] dev       : Structure instance of bmi08x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+static int8_t write_seq(const struct bmi08_reg_write *seq, uint8_t count, struct bmi08_dev *dev);
+
+/*!
+ *  @brief This API applies the delay required after a gyro register write
+ *  in the current power mode.
+ *
+ *  @param[in] dev       : Structure instance of bmi08x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+static int8_t write_delay(struct bmi08_dev *dev);
+
 /*!
  * @brief This API sets the data ready interrupt for gyro sensor.
  *
@@ -127,10 +155,12 @@ static int8_t set_gyro_data_ready_int(const struct bmi08_gyro_int_channel_cfg *i
 static int8_t set_fifo_int(const struct bmi08_gyro_int_channel_cfg *int_config, struct bmi08_dev *dev);
 
 /*!
- * @brief This API configures the pins which fire the
- * interrupt signal when any interrupt occurs.
+ * @brief This API computes the configuration of the pins which fire the
+ * interrupt signal when any interrupt occurs. The value is written by the
+ * caller as part of its register write sequence.
  *
  * @param[in] int_config  : Structure instance of bmi08x_gyro_int_channel_cfg.
+ * @param[out] data       : Interrupt pin configuration register value.
  * @param[in] dev         : Structure instance of bmi08x_dev.
  *
  * @return Result of API execution status
@@ -138,7 +168,9 @@ static int8_t set_fifo_int(const struct bmi08_gyro_int_channel_cfg *int_config,
  * @retval < 0 -> Fail
  *
  */
-static int8_t set_int_pin_config(const struct bmi08_gyro_int_channel_cfg *int_config, struct bmi08_dev *dev);
+static int8_t get_int_pin_config(const struct bmi08_gyro_int_channel_cfg *int_config,
+                                 uint8_t *data,
+                                 struct bmi08_dev *dev);
 
 /*!
  *  @brief This API enables or disables the Gyro Self test feature in the
@@ -304,20 +336,44 @@ int8_t bmi08g_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
             /* Writing to the register */
             rslt = set_regs(reg_addr, reg_data, len, dev);
 
-            /* Delay for suspended mode of the sensor is 450 us */
-            if (dev->gyro_cfg.power == BMI08_GYRO_PM_SUSPEND || dev->gyro_cfg.power == BMI08_GYRO_PM_DEEP_SUSPEND)
-            {
-                dev->delay_us(450, dev->intf_ptr_gyro);
-            }
-            /* Delay for Normal mode of the sensor is 2 us */
-            else if (dev->gyro_cfg.power == BMI08_GYRO_PM_NORMAL)
+            if (rslt == BMI08_OK)
             {
-                dev->delay_us(2, dev->intf_ptr_gyro);
+                rslt = write_delay(dev);
             }
-            else
+        }
+        else
+        {
+            rslt = BMI08_E_RD_WR_LENGTH_INVALID;
+        }
+    }
+    else
+    {
+        rslt = BMI08_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes a sequence of single byte registers of gyro sensor.
+ */
+int8_t bmi08g_write_seq(const struct bmi08_reg_write *seq, uint8_t count, struct bmi08_dev *dev)
+{
+    int8_t rslt;
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI08_OK) && (seq != NULL))
+    {
+        if ((count > 0) && (count <= BMI08_GYRO_WRITE_SEQ_MAX))
+        {
+            rslt = write_seq(seq, count, dev);
+
+            if (rslt == BMI08_OK)
             {
-                /* Invalid power input */
-                rslt = BMI08_E_INVALID_INPUT;
+                rslt = write_delay(dev);
             }
         }
         else
@@ -396,7 +452,8 @@ int8_t bmi08g_get_meas_conf(struct bmi08_dev *dev)
 int8_t bmi08g_set_meas_conf(struct bmi08_dev *dev)
 {
     int8_t rslt;
-    uint8_t data;
+    uint8_t data[2] = { 0 };
+    struct bmi08_reg_write seq[2];
     uint8_t odr, range;
     uint8_t is_range_invalid = FALSE, is_odr_invalid = FALSE;
 
@@ -424,29 +481,18 @@ int8_t bmi08g_set_meas_conf(struct bmi08_dev *dev)
         /* If ODR and Range is valid, write it to gyro config. registers */
         if ((!is_odr_invalid) && (!is_range_invalid))
         {
-            /* Read range value from the range register */
-            rslt = bmi08g_get_regs(BMI08_REG_GYRO_BANDWIDTH, &data, BMI08_REG_GYRO_BANDWIDTH_LENGTH, dev);
+            /* Read range and bandwidth registers, which are adjacent, in one go */
+            rslt = bmi08g_get_regs(BMI08_REG_GYRO_RANGE, data, 2, dev);
 
             if (rslt == BMI08_OK)
             {
-                data = BMI08_SET_BITS_POS_0(data, BMI08_GYRO_BW, odr);
-
-                /* Write odr value to odr register */
-                rslt = bmi08g_set_regs(BMI08_REG_GYRO_BANDWIDTH, &data, BMI08_REG_GYRO_BANDWIDTH_LENGTH, dev);
-
-                if (rslt == BMI08_OK)
-                {
-                    /* Read range value from the range register */
-                    rslt = bmi08g_get_regs(BMI08_REG_GYRO_RANGE, &data, (BMI08_REG_GYRO_RANGE_LENGTH - 2), dev);
-                }
+                /* Write odr value to odr register first, then range */
+                seq[0].addr = BMI08_REG_GYRO_BANDWIDTH;
+                seq[0].data = BMI08_SET_BITS_POS_0(data[1], BMI08_GYRO_BW, odr);
+                seq[1].addr = BMI08_REG_GYRO_RANGE;
+                seq[1].data = BMI08_SET_BITS_POS_0(data[0], BMI08_GYRO_RANGE, range);
 
-                if (rslt == BMI08_OK)
-                {
-                    data = BMI08_SET_BITS_POS_0(data, BMI08_GYRO_RANGE, range);
-
-                    /* Write range value to range register */
-                    rslt = bmi08g_set_regs(BMI08_REG_GYRO_RANGE, &data, (BMI08_REG_GYRO_RANGE_LENGTH - 2), dev);
-                }
+                rslt = bmi08g_write_seq(seq, 2, dev);
 
                 if (rslt == BMI08_OK)
                 {
@@ -1043,7 +1089,9 @@ static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct
 static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi08_dev *dev)
 {
     int8_t rslt = BMI08_OK;
-    uint8_t count = 0;
+    uint32_t count = 0;
+    uint8_t chunk, idx;
+    struct bmi08_reg_write seq[BMI08_GYRO_WRITE_SEQ_MAX];
 
     if (dev->intf == BMI08_SPI_INTF)
     {
@@ -1066,16 +1114,91 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
     }
 
     /* Burst write is not allowed thus we split burst case write
-     * into single byte writes Thus user can write multiple bytes
-     * with ease
+     * into a sequence of single byte writes, submitted together
+     * when the transport supports it
      */
     if (len > 1)
     {
-        for (count = 0; count < len; count++)
+        while ((count < len) && (rslt == BMI08_OK))
         {
-            dev->intf_rslt = dev->write(reg_addr, &reg_data[count], BMI08_GYRO_DATA_LENGTH, dev->intf_ptr_gyro);
+            /* Spacing between two sequences */
+            if (count > 0)
+            {
+                rslt = write_delay(dev);
 
-            reg_addr++;
+                if (rslt != BMI08_OK)
+                {
+                    break;
+                }
+            }
+
+            chunk = (uint8_t)(((len - count) > BMI08_GYRO_WRITE_SEQ_MAX) ? BMI08_GYRO_WRITE_SEQ_MAX : (len - count));
+
+            for (idx = 0; idx < chunk; idx++)
+            {
+                seq[idx].addr = (uint8_t)(reg_addr + count + idx);
+                seq[idx].data = reg_data[count + idx];
+            }
+
+            rslt = write_seq(seq, chunk, dev);
+            count += chunk;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes a sequence of single byte registers of gyro sensor.
+ */
+static int8_t write_seq(const struct bmi08_reg_write *seq, uint8_t count, struct bmi08_dev *dev)
+{
+    int8_t rslt = BMI08_OK;
+    uint8_t idx;
+    struct bmi08_reg_write spi_seq[BMI08_GYRO_WRITE_SEQ_MAX];
+    const struct bmi08_reg_write *out = seq;
+
+    if (dev->intf == BMI08_SPI_INTF)
+    {
+        /* Configuring reg_addr for SPI Interface */
+        for (idx = 0; idx < count; idx++)
+        {
+            spi_seq[idx].addr = (seq[idx].addr & BMI08_SPI_WR_MASK);
+            spi_seq[idx].data = seq[idx].data;
+        }
+
+        out = spi_seq;
+    }
+
+    if (dev->write_seq != NULL)
+    {
+        /* Whole sequence in one transport call */
+        dev->intf_rslt = dev->write_seq(out, count, dev->intf_ptr_gyro);
+
+        if (dev->intf_rslt != BMI08_INTF_RET_SUCCESS)
+        {
+            /* Failure case */
+            rslt = BMI08_E_COM_FAIL;
+        }
+    }
+    else
+    {
+        for (idx = 0; (idx < count) && (rslt == BMI08_OK); idx++)
+        {
+            /* Keep the write spacing between entries, the caller delays
+             * after the last one
+             */
+            if (idx > 0)
+            {
+                rslt = write_delay(dev);
+
+                if (rslt != BMI08_OK)
+                {
+                    break;
+                }
+            }
+
+            dev->intf_rslt = dev->write(out[idx].addr, &out[idx].data, BMI08_GYRO_DATA_LENGTH, dev->intf_ptr_gyro);
 
             if (dev->intf_rslt != BMI08_INTF_RET_SUCCESS)
             {
@@ -1089,13 +1212,40 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
     return rslt;
 }
 
+/*!
+ * @brief This API applies the delay required after a gyro register write.
+ */
+static int8_t write_delay(struct bmi08_dev *dev)
+{
+    int8_t rslt = BMI08_OK;
+
+    /* Delay for suspended mode of the sensor is 450 us */
+    if (dev->gyro_cfg.power == BMI08_GYRO_PM_SUSPEND || dev->gyro_cfg.power == BMI08_GYRO_PM_DEEP_SUSPEND)
+    {
+        dev->delay_us(450, dev->intf_ptr_gyro);
+    }
+    /* Delay for Normal mode of the sensor is 2 us */
+    else if (dev->gyro_cfg.power == BMI08_GYRO_PM_NORMAL)
+    {
+        dev->delay_us(2, dev->intf_ptr_gyro);
+    }
+    else
+    {
+        /* Invalid power input */
+        rslt = BMI08_E_INVALID_INPUT;
+    }
+
+    return rslt;
+}
+
 /*!
  * @brief This API sets the data ready interrupt for gyro sensor.
  */
 static int8_t set_gyro_data_ready_int(const struct bmi08_gyro_int_channel_cfg *int_config, struct bmi08_dev *dev)
 {
     int8_t rslt;
-    uint8_t conf, data[2] = { 0 };
+    uint8_t conf, data[3] = { 0 };
+    struct bmi08_reg_write seq[3];
 
     /* read interrupt map register */
     rslt = get_regs(BMI08_REG_GYRO_INT3_INT4_IO_MAP, &data[0], BMI08_REG_ACCEL_INT_MAP_CFG_LENGTH, dev);
@@ -1138,19 +1288,20 @@ static int8_t set_gyro_data_ready_int(const struct bmi08_gyro_int_channel_cfg *i
                 data[1] = BMI08_GYRO_DRDY_INT_DISABLE_VAL;
             }
 
-            /* write data to interrupt map register */
-            rslt = bmi08g_set_regs(BMI08_REG_GYRO_INT3_INT4_IO_MAP, &data[0], BMI08_REG_ACCEL_INT_MAP_CFG_LENGTH, dev);
+            /* Configure interrupt pin */
+            rslt = get_int_pin_config(int_config, &data[2], dev);
 
             if (rslt == BMI08_OK)
             {
-                /* Configure interrupt pin */
-                rslt = set_int_pin_config(int_config, dev);
-
-                if (rslt == BMI08_OK)
-                {
-                    /* Write data to interrupt control register */
-                    rslt = bmi08g_set_regs(BMI08_REG_GYRO_INT_CTRL, &data[1], BMI08_REG_GYRO_INT_CTRL_LENGTH, dev);
-                }
+                /* Write interrupt map, pin configuration and interrupt control registers */
+                seq[0].addr = BMI08_REG_GYRO_INT3_INT4_IO_MAP;
+                seq[0].data = data[0];
+                seq[1].addr = BMI08_REG_GYRO_INT3_INT4_IO_CONF;
+                seq[1].data = data[2];
+                seq[2].addr = BMI08_REG_GYRO_INT_CTRL;
+                seq[2].data = data[1];
+
+                rslt = bmi08g_write_seq(seq, 3, dev);
             }
         }
     }
@@ -1164,7 +1315,8 @@ static int8_t set_gyro_data_ready_int(const struct bmi08_gyro_int_channel_cfg *i
 static int8_t set_fifo_int(const struct bmi08_gyro_int_channel_cfg *int_config, struct bmi08_dev *dev)
 {
     int8_t rslt;
-    uint8_t conf, data[2] = { 0 };
+    uint8_t conf, data[3] = { 0 };
+    struct bmi08_reg_write seq[3];
 
     /* Read interrupt map register */
     rslt = get_regs(BMI08_REG_GYRO_INT3_INT4_IO_MAP, &data[0], BMI08_REG_ACCEL_INT_MAP_CFG_LENGTH, dev);
@@ -1207,19 +1359,20 @@ static int8_t set_fifo_int(const struct bmi08_gyro_int_channel_cfg *int_config,
                 data[1] = BMI08_GYRO_FIFO_INT_DISABLE_VAL;
             }
 
-            /* write data to interrupt map register */
-            rslt = bmi08g_set_regs(BMI08_REG_GYRO_INT3_INT4_IO_MAP, &data[0], BMI08_REG_ACCEL_INT_MAP_CFG_LENGTH, dev);
+            /* Configure interrupt pin */
+            rslt = get_int_pin_config(int_config, &data[2], dev);
 
             if (rslt == BMI08_OK)
             {
-                /* Configure interrupt pin */
-                rslt = set_int_pin_config(int_config, dev);
-
-                if (rslt == BMI08_OK)
-                {
-                    /* write data to interrupt control register */
-                    rslt = bmi08g_set_regs(BMI08_REG_GYRO_INT_CTRL, &data[1], BMI08_REG_GYRO_INT_CTRL_LENGTH, dev);
-                }
+                /* Write interrupt map, pin configuration and interrupt control registers */
+                seq[0].addr = BMI08_REG_GYRO_INT3_INT4_IO_MAP;
+                seq[0].data = data[0];
+                seq[1].addr = BMI08_REG_GYRO_INT3_INT4_IO_CONF;
+                seq[1].data = data[2];
+                seq[2].addr = BMI08_REG_GYRO_INT_CTRL;
+                seq[2].data = data[1];
+
+                rslt = bmi08g_write_seq(seq, 3, dev);
             }
         }
     }
@@ -1228,10 +1381,12 @@ static int8_t set_fifo_int(const struct bmi08_gyro_int_channel_cfg *int_config,
 }
 
 /*!
- * @brief This API configures the pins which fire the
+ * @brief This API computes the configuration of the pins which fire the
  * interrupt signal when any interrupt occurs.
  */
-static int8_t set_int_pin_config(const struct bmi08_gyro_int_channel_cfg *int_config, struct bmi08_dev *dev)
+static int8_t get_int_pin_config(const struct bmi08_gyro_int_channel_cfg *int_config,
+                                 uint8_t *reg_data,
+                                 struct bmi08_dev *dev)
 {
     int8_t rslt;
     uint8_t data;
@@ -1262,8 +1417,8 @@ static int8_t set_int_pin_config(const struct bmi08_gyro_int_channel_cfg *int_co
                 break;
         }
 
-        /* write to interrupt configuration register */
-        rslt = bmi08g_set_regs(BMI08_REG_GYRO_INT3_INT4_IO_CONF, &data, BMI08_REG_GYRO_INT_IO_CONF_LENGTH, dev);
+        /* Value to be written to interrupt configuration register */
+        *reg_data = data;
     }
 
     return rslt;
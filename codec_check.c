@@ -0,0 +1,205 @@
+// Self-check for the block codec and capture files, run by `make check`.
+// Exits non-zero on the first class of failure found.
+
+#include "imu_capture.h"
+#include "imu_codec.h"
+#include "imu_error.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAP_BYTES (1u << 20)
+
+static struct imu_block in, out;
+static uint8_t enc[IMU_CODEC_MAX_BYTES];
+static uint8_t file[CAP_BYTES];
+static struct imu_capture_writer w;
+static unsigned failures;
+
+static uint64_t rng = 0x9e3779b97f4a7c15u;
+
+static uint64_t next(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return rng;
+}
+
+static void fail(const char *what, unsigned long long arg) {
+  if (failures++ < 10)
+    fprintf(stderr, "codec_check: %s (%llu)\n", what, arg);
+}
+
+static int same_block(const struct imu_block *a, const struct imu_block *b) {
+  if (a->n != b->n)
+    return 0;
+  for (size_t i = 0; i < a->n; i++) {
+    if (a->x[i] != b->x[i] || a->y[i] != b->y[i] || a->z[i] != b->z[i] ||
+        a->t[i] != b->t[i])
+      return 0;
+  }
+  return 1;
+}
+
+// Quiet, full-scale, alternating-extreme and gappy blocks of length n.
+static void make_block(struct imu_block *b, size_t n, unsigned kind,
+                       uint64_t t0) {
+  uint64_t t = t0;
+
+  b->n = n;
+  for (size_t i = 0; i < n; i++) {
+    switch (kind) {
+    case 0:
+      b->x[i] = (int16_t)(100 + (int)(next() % 9) - 4);
+      b->y[i] = (int16_t)(-50 + (int)(next() % 9) - 4);
+      b->z[i] = (int16_t)(8192 + (int)(next() % 9) - 4);
+      break;
+    case 1:
+      b->x[i] = (int16_t)next();
+      b->y[i] = (int16_t)next();
+      b->z[i] = (int16_t)next();
+      break;
+    default:
+      b->x[i] = (i & 1) ? INT16_MAX : INT16_MIN;
+      b->y[i] = (i & 1) ? INT16_MIN : INT16_MAX;
+      b->z[i] = 0;
+      break;
+    }
+    b->t[i] = t;
+    t += 625000;
+    if (kind == 3 && i % 17 == 16)
+      t += next() >> 8; // gaps up to 2^56 ns
+    if (kind == 4)
+      t += next() % 1000;
+  }
+}
+
+static void check_codec(void) {
+  for (unsigned kind = 0; kind < 5; kind++) {
+    for (size_t n = 0; n <= IMU_BLOCK_CAP; n++) {
+      int len, used;
+
+      make_block(&in, n, kind, next() >> 1);
+      len = imu_codec_encode(&in, enc, sizeof(enc));
+      if (len < 0) {
+        fail("encode failed", n);
+        continue;
+      }
+      memset(&out, 0x5a, sizeof(out));
+      used = imu_codec_decode(enc, (size_t)len, &out);
+      if (used != len || !same_block(&in, &out))
+        fail("round trip differs", n);
+      if (len > 2 && imu_codec_decode(enc, (size_t)len - 1, &out) !=
+                         IMU_E_FORMAT)
+        fail("truncated block accepted", n);
+      if (imu_codec_encode(&in, enc, (size_t)len - 1) != IMU_E_FULL)
+        fail("short output accepted", n);
+    }
+  }
+}
+
+// Writes blocks into a capture image in memory; returns its length.
+static size_t write_capture(enum imu_capture_encoding encoding,
+                            uint32_t chunk_records, unsigned blocks) {
+  FILE *f = tmpfile();
+  uint64_t t[2] = {1000, 1300};
+  size_t len;
+
+  if (f == NULL || imu_capture_start(&w, f, encoding) != IMU_OK) {
+    fail("capture start", 0);
+    return 0;
+  }
+  w.chunk_records = chunk_records;
+  for (unsigned i = 0; i < blocks; i++) {
+    unsigned dev = i % 2;
+
+    make_block(&in, i % 40 == 0 ? 0 : 64, 0, t[dev]);
+    if (in.n > 0)
+      t[dev] = in.t[in.n - 1] + 625000;
+    if (imu_capture_write(&w, (uint16_t)dev,
+                          i % 4 < 2 ? IMU_CAPTURE_ACCEL : IMU_CAPTURE_GYRO,
+                          &in) != IMU_OK)
+      fail("capture write", i);
+  }
+  if (imu_capture_finish(&w) != IMU_OK)
+    fail("capture finish", 0);
+  len = (size_t)ftell(f);
+  rewind(f);
+  if (len > sizeof(file) || fread(file, 1, len, f) != len)
+    fail("capture read back", len);
+  fclose(f);
+  return len;
+}
+
+static void check_capture(enum imu_capture_encoding encoding) {
+  static struct imu_capture_chunk idx[512];
+  struct imu_capture_reader r, sub;
+  size_t len = write_capture(encoding, 5, 1000), count = 0;
+  uint64_t samples = 0;
+
+  if (imu_capture_reader_init(&r, file, len) != IMU_OK || r.last_index == 0) {
+    fail("capture footer", encoding);
+    return;
+  }
+  if (imu_capture_index(&r, idx, 512, &count) != IMU_OK || count != 200)
+    fail("index size", count);
+
+  // Chunk readers together see every sample once, in order.
+  for (size_t c = 0; c < count; c++) {
+    uint32_t records = 0;
+
+    if (c > 0 && idx[c].t_last < idx[c - 1].t_last)
+      fail("t_last decreases", c);
+    if (imu_capture_chunk_reader(&r, &idx[c], &sub) != IMU_OK)
+      fail("chunk reader", c);
+    while (imu_capture_next(&sub, NULL, NULL, &out) == IMU_OK) {
+      records++;
+      samples += out.n;
+    }
+    if (records != idx[c].records)
+      fail("chunk records", c);
+  }
+  if (samples != w.samples)
+    fail("chunk samples", samples);
+
+  // Seek against a linear scan.
+  for (unsigned q = 0; q < 1000; q++) {
+    uint64_t t = next() % (idx[count - 1].t_last + 2000000);
+    size_t lin = 0;
+
+    while (lin < count && idx[lin].t_last < t)
+      lin++;
+    if (imu_capture_seek(idx, count, t) != lin)
+      fail("seek", t);
+  }
+
+  // Without the footer the index is rebuilt up to the last INDEX record.
+  if (imu_capture_reader_init(&r, file, len - IMU_CAPTURE_FOOTER - 1) !=
+          IMU_OK ||
+      r.last_index != 0 || imu_capture_index(&r, idx, 512, &count) != IMU_OK ||
+      count == 0 || count >= 200)
+    fail("torn capture index", count);
+}
+
+static void check_empty_capture(void) {
+  struct imu_capture_reader r;
+  size_t len = write_capture(IMU_CAPTURE_PACKED, 5, 0), count;
+
+  if (imu_capture_reader_init(&r, file, len) != IMU_OK ||
+      imu_capture_next(&r, NULL, NULL, &out) != IMU_E_NOT_FOUND ||
+      imu_capture_index(&r, NULL, 0, &count) != IMU_E_NOT_FOUND)
+    fail("empty capture", len);
+}
+
+int main(void) {
+  check_codec();
+  check_capture(IMU_CAPTURE_RAW);
+  check_capture(IMU_CAPTURE_PACKED);
+  check_empty_capture();
+  if (failures != 0) {
+    fprintf(stderr, "codec_check: %u failures\n", failures);
+    return 1;
+  }
+  printf("codec_check: ok\n");
+  return 0;
+}
@@ -0,0 +1,285 @@
+#include "imu_ahrs.h"
+#include "imu_clock.h"
+#include <math.h>
+#include <string.h>
+
+#define Q30_ONE (INT64_C(1) << 30)
+
+// Keeps the reciprocal finite for a zero vector instead of branching on it.
+static inline float inv_norm(float sq) { return 1.0f / sqrtf(sq + 1e-20f); }
+
+// Strided view over accel/gyro pairs, so the batch loops serve both the
+// AoS driver structs (stride 3) and imu_block lanes (stride 1).
+struct pair_view {
+  const int16_t *ax, *ay, *az;
+  const int16_t *gx, *gy, *gz;
+  size_t stride;
+};
+
+static struct pair_view aos_view(const struct bmi08_sensor_data *accel,
+                                 const struct bmi08_sensor_data *gyro) {
+  struct pair_view v = {&accel->x, &accel->y, &accel->z,
+                        &gyro->x,  &gyro->y,  &gyro->z,
+                        sizeof(*accel) / sizeof(int16_t)};
+  return v;
+}
+
+static void madgwick_batch(struct imu_ahrs *f, const struct pair_view *v,
+                           size_t n) {
+  const float dt = f->cfg.dt, beta = f->cfg.beta;
+  const float gs = f->cfg.gyro_rad_per_lsb;
+  const float bx = f->cfg.gyro_bias[0], by = f->cfg.gyro_bias[1],
+              bz = f->cfg.gyro_bias[2];
+  float q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+
+  for (size_t i = 0; i < n; i++) {
+    const size_t k = i * v->stride;
+    float gx = ((float)v->gx[k] - bx) * gs;
+    float gy = ((float)v->gy[k] - by) * gs;
+    float gz = ((float)v->gz[k] - bz) * gs;
+    float ax = v->ax[k], ay = v->ay[k], az = v->az[k];
+    float r, s0, s1, s2, s3;
+
+    r = inv_norm(ax * ax + ay * ay + az * az);
+    ax *= r;
+    ay *= r;
+    az *= r;
+
+    // Gradient of the gravity error, from Madgwick's IMU formulation.
+    float _2q0 = 2.0f * q0, _2q1 = 2.0f * q1, _2q2 = 2.0f * q2,
+          _2q3 = 2.0f * q3;
+    float _4q0 = 4.0f * q0, _4q1 = 4.0f * q1, _4q2 = 4.0f * q2;
+    float _8q1 = 8.0f * q1, _8q2 = 8.0f * q2;
+    float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+    s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+    s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 +
+         _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+    s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 +
+         _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+    s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+    r = beta * inv_norm(s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3);
+
+    float d0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz) - r * s0;
+    float d1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy) - r * s1;
+    float d2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx) - r * s2;
+    float d3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx) - r * s3;
+
+    q0 += d0 * dt;
+    q1 += d1 * dt;
+    q2 += d2 * dt;
+    q3 += d3 * dt;
+    r = inv_norm(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    q0 *= r;
+    q1 *= r;
+    q2 *= r;
+    q3 *= r;
+  }
+
+  f->q[0] = q0;
+  f->q[1] = q1;
+  f->q[2] = q2;
+  f->q[3] = q3;
+}
+
+static void mahony_batch(struct imu_ahrs *f, const struct pair_view *v,
+                         size_t n) {
+  const float half_dt = 0.5f * f->cfg.dt;
+  const float two_kp = 2.0f * f->cfg.kp;
+  const float two_ki_dt = 2.0f * f->cfg.ki * f->cfg.dt;
+  const float gs = f->cfg.gyro_rad_per_lsb;
+  const float bx = f->cfg.gyro_bias[0], by = f->cfg.gyro_bias[1],
+              bz = f->cfg.gyro_bias[2];
+  float q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+  float ix = f->integral[0], iy = f->integral[1], iz = f->integral[2];
+
+  for (size_t i = 0; i < n; i++) {
+    const size_t k = i * v->stride;
+    float gx = ((float)v->gx[k] - bx) * gs;
+    float gy = ((float)v->gy[k] - by) * gs;
+    float gz = ((float)v->gz[k] - bz) * gs;
+    float ax = v->ax[k], ay = v->ay[k], az = v->az[k];
+    float r = inv_norm(ax * ax + ay * ay + az * az);
+
+    ax *= r;
+    ay *= r;
+    az *= r;
+
+    // Half of the gravity direction predicted by the current attitude.
+    float vx = q1 * q3 - q0 * q2;
+    float vy = q0 * q1 + q2 * q3;
+    float vz = q0 * q0 - 0.5f + q3 * q3;
+    float ex = ay * vz - az * vy;
+    float ey = az * vx - ax * vz;
+    float ez = ax * vy - ay * vx;
+
+    ix += two_ki_dt * ex;
+    iy += two_ki_dt * ey;
+    iz += two_ki_dt * ez;
+    gx = (gx + two_kp * ex + ix) * half_dt;
+    gy = (gy + two_kp * ey + iy) * half_dt;
+    gz = (gz + two_kp * ez + iz) * half_dt;
+
+    float p0 = q0, p1 = q1, p2 = q2;
+    q0 += -p1 * gx - p2 * gy - q3 * gz;
+    q1 += p0 * gx + p2 * gz - q3 * gy;
+    q2 += p0 * gy - p1 * gz + q3 * gx;
+    q3 += p0 * gz + p1 * gy - p2 * gx;
+    r = inv_norm(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    q0 *= r;
+    q1 *= r;
+    q2 *= r;
+    q3 *= r;
+  }
+
+  f->q[0] = q0;
+  f->q[1] = q1;
+  f->q[2] = q2;
+  f->q[3] = q3;
+  f->integral[0] = ix;
+  f->integral[1] = iy;
+  f->integral[2] = iz;
+}
+
+void imu_ahrs_init(struct imu_ahrs *f, const struct imu_ahrs_config *cfg) {
+  memset(f, 0, sizeof(*f));
+  f->cfg = *cfg;
+  f->q[0] = 1.0f;
+}
+
+static void update_view(struct imu_ahrs *f, const struct pair_view *v,
+                        size_t n) {
+  uint64_t start = imu_cycles();
+
+  if (f->cfg.algo == IMU_AHRS_MAHONY)
+    mahony_batch(f, v, n);
+  else
+    madgwick_batch(f, v, n);
+
+  f->perf.cycles += imu_cycles() - start;
+  f->perf.updates += n;
+}
+
+void imu_ahrs_update(struct imu_ahrs *f, const struct bmi08_sensor_data *accel,
+                     const struct bmi08_sensor_data *gyro, size_t n) {
+  struct pair_view v;
+
+  if (n == 0)
+    return;
+  v = aos_view(accel, gyro);
+  update_view(f, &v, n);
+}
+
+void imu_ahrs_update_block(struct imu_ahrs *f, const struct imu_block *accel,
+                           const struct imu_block *gyro) {
+  struct pair_view v = {accel->x, accel->y, accel->z,
+                        gyro->x,  gyro->y,  gyro->z, 1};
+
+  update_view(f, &v, accel->n < gyro->n ? accel->n : gyro->n);
+}
+
+// Bit-by-bit integer square root; fixed iteration count.
+static uint32_t isqrt64(uint64_t v) {
+  uint64_t res = 0, bit = UINT64_C(1) << 62;
+
+  for (int i = 0; i < 32; i++) {
+    uint64_t t = res + bit;
+    uint64_t ge = v >= t;
+    v -= t & (0 - ge);
+    res = (res >> 1) + (bit & (0 - ge));
+    bit >>= 2;
+  }
+  return (uint32_t)res;
+}
+
+static inline int32_t q30_mul(int64_t a, int64_t b) {
+  return (int32_t)((a * b) >> 30);
+}
+
+void imu_ahrs_fx_init(struct imu_ahrs_fx *f,
+                      const struct imu_ahrs_config *cfg) {
+  memset(f, 0, sizeof(*f));
+  f->q[0] = (int32_t)Q30_ONE;
+  for (int a = 0; a < 3; a++)
+    f->gyro_bias[a] = (int16_t)lrintf(cfg->gyro_bias[a]);
+  f->gyro_scale = llrint(cfg->gyro_rad_per_lsb * 4294967296.0);
+  f->half_dt = llrint(0.5 * cfg->dt * 4294967296.0);
+  f->two_kp = llrint(2.0 * cfg->kp * 65536.0);
+  f->two_ki_dt = llrint(2.0 * cfg->ki * cfg->dt * 4294967296.0);
+}
+
+void imu_ahrs_fx_update(struct imu_ahrs_fx *f,
+                        const struct bmi08_sensor_data *accel,
+                        const struct bmi08_sensor_data *gyro, size_t n) {
+  uint64_t start = imu_cycles();
+  int32_t q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+  int32_t ix = f->integral[0], iy = f->integral[1], iz = f->integral[2];
+
+  for (size_t i = 0; i < n; i++) {
+    int64_t ax = accel[i].x, ay = accel[i].y, az = accel[i].z;
+    int64_t mag = (int64_t)isqrt64((uint64_t)(ax * ax + ay * ay + az * az)) + 1;
+    int32_t nax = (int32_t)((ax * Q30_ONE) / mag);
+    int32_t nay = (int32_t)((ay * Q30_ONE) / mag);
+    int32_t naz = (int32_t)((az * Q30_ONE) / mag);
+
+    int32_t vx = q30_mul(q1, q3) - q30_mul(q0, q2);
+    int32_t vy = q30_mul(q0, q1) + q30_mul(q2, q3);
+    int32_t vz = q30_mul(q0, q0) - (int32_t)(Q30_ONE / 2) + q30_mul(q3, q3);
+    int32_t ex = q30_mul(nay, vz) - q30_mul(naz, vy);
+    int32_t ey = q30_mul(naz, vx) - q30_mul(nax, vz);
+    int32_t ez = q30_mul(nax, vy) - q30_mul(nay, vx);
+
+    // Integral term kept in Q30 rad/s, the rest of the rate math in Q16.
+    ix += (int32_t)((f->two_ki_dt * ex) >> 32);
+    iy += (int32_t)((f->two_ki_dt * ey) >> 32);
+    iz += (int32_t)((f->two_ki_dt * ez) >> 32);
+
+    int64_t gx = (((int64_t)gyro[i].x - f->gyro_bias[0]) * f->gyro_scale) >> 16;
+    int64_t gy = (((int64_t)gyro[i].y - f->gyro_bias[1]) * f->gyro_scale) >> 16;
+    int64_t gz = (((int64_t)gyro[i].z - f->gyro_bias[2]) * f->gyro_scale) >> 16;
+    gx += ((f->two_kp * ex) >> 30) + (ix >> 14);
+    gy += ((f->two_kp * ey) >> 30) + (iy >> 14);
+    gz += ((f->two_kp * ez) >> 30) + (iz >> 14);
+
+    // Half-angle increments in Q30.
+    int32_t hx = (int32_t)((gx * f->half_dt) >> 18);
+    int32_t hy = (int32_t)((gy * f->half_dt) >> 18);
+    int32_t hz = (int32_t)((gz * f->half_dt) >> 18);
+
+    int32_t p0 = q0, p1 = q1, p2 = q2;
+    q0 += -q30_mul(p1, hx) - q30_mul(p2, hy) - q30_mul(q3, hz);
+    q1 += q30_mul(p0, hx) + q30_mul(p2, hz) - q30_mul(q3, hy);
+    q2 += q30_mul(p0, hy) - q30_mul(p1, hz) + q30_mul(q3, hx);
+    q3 += q30_mul(p0, hz) + q30_mul(p1, hy) - q30_mul(p2, hx);
+
+    // Steps are small, so a first-order 1/sqrt around 1 renormalizes.
+    int64_t n2 = ((int64_t)q0 * q0 + (int64_t)q1 * q1 + (int64_t)q2 * q2 +
+                  (int64_t)q3 * q3) >> 30;
+    int64_t r = (3 * Q30_ONE - n2) >> 1;
+    q0 = q30_mul(q0, r);
+    q1 = q30_mul(q1, r);
+    q2 = q30_mul(q2, r);
+    q3 = q30_mul(q3, r);
+  }
+
+  f->q[0] = q0;
+  f->q[1] = q1;
+  f->q[2] = q2;
+  f->q[3] = q3;
+  f->integral[0] = ix;
+  f->integral[1] = iy;
+  f->integral[2] = iz;
+  f->perf.cycles += imu_cycles() - start;
+  f->perf.updates += n;
+}
+
+void imu_ahrs_fx_quat(const struct imu_ahrs_fx *f, float q[4]) {
+  for (int i = 0; i < 4; i++)
+    q[i] = (float)f->q[i] / (float)Q30_ONE;
+}
+
+double imu_ahrs_cycles_per_update(const struct imu_ahrs_perf *perf) {
+  if (perf->updates == 0)
+    return 0.0;
+  return (double)perf->cycles / (double)perf->updates;
+}
@@ -0,0 +1,71 @@
+#ifndef IMU_AHRS_H
+#define IMU_AHRS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_block.h"
+
+enum imu_ahrs_algo { IMU_AHRS_MADGWICK, IMU_AHRS_MAHONY };
+
+struct imu_ahrs_config {
+  enum imu_ahrs_algo algo;
+  // Sample period of the synchronized stream in seconds.
+  float dt;
+  // Gyro conversion and static bias, both in raw LSB terms.
+  float gyro_rad_per_lsb;
+  float gyro_bias[3];
+  // Madgwick gradient step.
+  float beta;
+  // Mahony proportional and integral gains.
+  float kp;
+  float ki;
+};
+
+// Accumulated update cost, measured around whole batches.
+struct imu_ahrs_perf {
+  uint64_t cycles;
+  uint64_t updates;
+};
+
+// Float estimator. Quaternion is w, x, y, z.
+struct imu_ahrs {
+  struct imu_ahrs_config cfg;
+  float q[4];
+  float integral[3];
+  struct imu_ahrs_perf perf;
+};
+
+// Fixed-point Mahony estimator for targets without an FPU. The quaternion
+// is Q2.30, angular rates are Q16.16 rad/s.
+struct imu_ahrs_fx {
+  int32_t q[4];
+  int32_t integral[3];
+  int16_t gyro_bias[3];
+  int64_t gyro_scale;
+  int64_t half_dt;
+  int64_t two_kp;
+  int64_t two_ki_dt;
+  struct imu_ahrs_perf perf;
+};
+
+void imu_ahrs_init(struct imu_ahrs *f, const struct imu_ahrs_config *cfg);
+
+// Runs one update per accel/gyro pair, e.g. as returned by
+// bmi08a_get_synchronized_data(). Never allocates.
+void imu_ahrs_update(struct imu_ahrs *f, const struct bmi08_sensor_data *accel,
+                     const struct bmi08_sensor_data *gyro, size_t n);
+// Same, on min(accel->n, gyro->n) pairs of lanes.
+void imu_ahrs_update_block(struct imu_ahrs *f, const struct imu_block *accel,
+                           const struct imu_block *gyro);
+
+void imu_ahrs_fx_init(struct imu_ahrs_fx *f, const struct imu_ahrs_config *cfg);
+void imu_ahrs_fx_update(struct imu_ahrs_fx *f,
+                        const struct bmi08_sensor_data *accel,
+                        const struct bmi08_sensor_data *gyro, size_t n);
+void imu_ahrs_fx_quat(const struct imu_ahrs_fx *f, float q[4]);
+
+double imu_ahrs_cycles_per_update(const struct imu_ahrs_perf *perf);
+
+#endif // IMU_AHRS_H
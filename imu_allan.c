@@ -0,0 +1,193 @@
+#include "imu_allan.h"
+#include "imu_error.h"
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+// sigma_min / B for a flicker floor, sqrt(2 ln 2 / pi).
+#define BIAS_INSTABILITY_FACTOR 0.664282
+// Local slope must land this close to -1/2 or +1/2 for ARW or RRW.
+#define SLOPE_TOLERANCE 0.25
+
+int imu_allan_init(struct imu_allan *a, double *storage, size_t len,
+                   double fs_hz, uint32_t m_max, unsigned per_decade,
+                   unsigned threads) {
+  uint64_t ring = 1;
+
+  if (a == NULL || storage == NULL)
+    return IMU_E_NULL_PTR;
+  if (!(fs_hz > 0.0) || m_max == 0 || per_decade == 0)
+    return IMU_E_INVALID_INPUT;
+
+  while (ring * 2 <= len / 3)
+    ring *= 2;
+  if (ring < 4 * (uint64_t)m_max)
+    return IMU_E_FULL;
+
+  memset(a, 0, sizeof(*a));
+  for (unsigned i = 0; i < 3; i++) {
+    a->ring[i] = storage + i * ring;
+    a->ring[i][0] = 0.0; // theta before the first sample
+  }
+  a->mask = ring - 1;
+  a->chunk = ring - 2 * (uint64_t)m_max - 1;
+  a->fs_hz = fs_hz;
+  a->m_max = m_max;
+  a->threads = threads > 0 ? threads : 1;
+
+  for (unsigned i = 0; a->nclusters < IMU_ALLAN_MAX_CLUSTERS; i++) {
+    double m = floor(pow(10.0, (double)i / per_decade) + 0.5);
+    if (m > m_max)
+      break;
+    if (a->nclusters > 0 && (uint32_t)m == a->cl[a->nclusters - 1].m)
+      continue;
+    a->cl[a->nclusters++].m = (uint32_t)m;
+  }
+  return IMU_OK;
+}
+
+struct work {
+  struct imu_allan *a;
+  unsigned first;
+  unsigned stride;
+  uint64_t lo; // first theta index to finish a triple
+  uint64_t hi; // last one
+};
+
+static void *run_work(void *arg) {
+  const struct work *w = arg;
+  struct imu_allan *a = w->a;
+  const uint64_t mask = a->mask;
+
+  for (unsigned c = w->first; c < a->nclusters; c += w->stride) {
+    struct imu_allan_cluster *cl = &a->cl[c];
+    const uint64_t m = cl->m;
+    const uint64_t lo = w->lo > 2 * m ? w->lo : 2 * m;
+
+    if (lo > w->hi)
+      continue;
+    for (unsigned axis = 0; axis < 3; axis++) {
+      const double *r = a->ring[axis];
+      double s = 0.0;
+      for (uint64_t j = lo; j <= w->hi; j++) {
+        double d =
+            r[j & mask] - 2.0 * r[(j - m) & mask] + r[(j - 2 * m) & mask];
+        s += d * d;
+      }
+      cl->sum[axis] += s;
+    }
+    cl->count += w->hi - lo + 1;
+  }
+  return NULL;
+}
+
+int imu_allan_flush(struct imu_allan *a) {
+  struct work w[IMU_ALLAN_MAX_CLUSTERS];
+  pthread_t tid[IMU_ALLAN_MAX_CLUSTERS];
+  unsigned n, started = 0;
+
+  if (a == NULL)
+    return IMU_E_NULL_PTR;
+  if (a->pushed == a->done)
+    return IMU_OK;
+
+  // Clusters are dealt round-robin so each thread gets small and large m.
+  n = a->threads < a->nclusters ? a->threads : a->nclusters;
+  for (unsigned t = 0; t < n; t++) {
+    w[t].a = a;
+    w[t].first = t;
+    w[t].stride = n;
+    w[t].lo = a->done + 1;
+    w[t].hi = a->pushed;
+  }
+  for (unsigned t = 1; t < n; t++) {
+    if (pthread_create(&tid[t], NULL, run_work, &w[t]) != 0)
+      break;
+    started = t;
+  }
+  run_work(&w[0]);
+  // Whatever could not get a thread runs here.
+  for (unsigned t = started + 1; t < n; t++)
+    run_work(&w[t]);
+  for (unsigned t = 1; t <= started; t++)
+    pthread_join(tid[t], NULL);
+
+  a->done = a->pushed;
+  return IMU_OK;
+}
+
+int imu_allan_push(struct imu_allan *a, const struct imu_block_f *b) {
+  const float *lane[3];
+
+  if (a == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+  if (a->nclusters == 0)
+    return IMU_E_NOT_READY;
+
+  lane[0] = b->x;
+  lane[1] = b->y;
+  lane[2] = b->z;
+  for (size_t i = 0; i < b->n; i++) {
+    a->pushed++;
+    for (unsigned axis = 0; axis < 3; axis++) {
+      a->theta[axis] += lane[axis][i];
+      a->ring[axis][a->pushed & a->mask] = a->theta[axis];
+    }
+    if (a->pushed - a->done == a->chunk)
+      imu_allan_flush(a);
+  }
+  return IMU_OK;
+}
+
+unsigned imu_allan_curve(const struct imu_allan *a, unsigned axis,
+                         double *tau, double *adev, unsigned max) {
+  unsigned n = 0;
+
+  if (a == NULL || axis > 2)
+    return 0;
+  for (unsigned c = 0; c < a->nclusters && n < max; c++) {
+    const struct imu_allan_cluster *cl = &a->cl[c];
+    double m = cl->m;
+
+    if (cl->count == 0)
+      break;
+    tau[n] = m / a->fs_hz;
+    adev[n] = sqrt(cl->sum[axis] / (2.0 * m * m * (double)cl->count));
+    n++;
+  }
+  return n;
+}
+
+int imu_allan_noise(const struct imu_allan *a, unsigned axis,
+                    struct imu_allan_noise *out) {
+  double tau[IMU_ALLAN_MAX_CLUSTERS], adev[IMU_ALLAN_MAX_CLUSTERS];
+  double best_arw = SLOPE_TOLERANCE, best_rrw = SLOPE_TOLERANCE;
+  unsigned n, lowest = 0;
+
+  if (a == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  n = imu_allan_curve(a, axis, tau, adev, IMU_ALLAN_MAX_CLUSTERS);
+  if (n < 2)
+    return IMU_E_NOT_READY;
+
+  memset(out, 0, sizeof(*out));
+  for (unsigned i = 0; i < n; i++) {
+    if (adev[i] < adev[lowest])
+      lowest = i;
+    if (i + 1 == n || adev[i] <= 0.0 || adev[i + 1] <= 0.0)
+      continue;
+    double slope = log(adev[i + 1] / adev[i]) / log(tau[i + 1] / tau[i]);
+    // sigma = N / sqrt(tau) and sigma = K * sqrt(tau / 3) on those lines.
+    if (fabs(slope + 0.5) < best_arw) {
+      best_arw = fabs(slope + 0.5);
+      out->arw = adev[i] * sqrt(tau[i]);
+    }
+    if (fabs(slope - 0.5) < best_rrw) {
+      best_rrw = fabs(slope - 0.5);
+      out->rrw = adev[i + 1] * sqrt(3.0 / tau[i + 1]);
+    }
+  }
+  out->bias_instability = adev[lowest] / BIAS_INSTABILITY_FACTOR;
+  out->tau_bias = tau[lowest];
+  return IMU_OK;
+}
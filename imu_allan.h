@@ -0,0 +1,67 @@
+#ifndef IMU_ALLAN_H
+#define IMU_ALLAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Overlapping Allan deviation for long captures. Samples are pushed block
+// by block and summed into theta, the running integral. For cluster size
+// m the Allan variance is then the mean of
+// (theta[k + 2m] - 2 theta[k + m] + theta[k])^2 / (2 m^2), so every
+// cluster needs theta only 2 * m_max samples back. That history lives in
+// a ring inside caller-provided storage, and a capture of any length
+// streams through it. Cluster sizes are log spaced; when the ring fills,
+// they are split across worker threads that all read the same history.
+
+#define IMU_ALLAN_MAX_CLUSTERS 128
+
+struct imu_allan_cluster {
+  uint32_t m;
+  uint64_t count;
+  double sum[3];
+};
+
+// IEEE 952 style read-outs, in the input's units: ARW in units/sqrt(s)
+// (rad/s input gives rad/sqrt(s)), bias instability in units, RRW in
+// units*s^-1/2 / s.
+struct imu_allan_noise {
+  double arw;
+  double bias_instability;
+  double tau_bias; // cluster time of the ADEV minimum, s
+  double rrw;
+};
+
+struct imu_allan {
+  double *ring[3];
+  uint64_t mask;
+  uint64_t chunk; // samples processed per flush
+  uint64_t pushed;
+  uint64_t done;
+  double theta[3];
+  double fs_hz;
+  uint32_t m_max;
+  unsigned threads;
+  unsigned nclusters;
+  struct imu_allan_cluster cl[IMU_ALLAN_MAX_CLUSTERS];
+};
+
+// storage holds len doubles; the ring takes the largest power of two
+// that fits len / 3, and has to be at least 4 * m_max. per_decade sets
+// the number of cluster sizes per decade of tau.
+int imu_allan_init(struct imu_allan *a, double *storage, size_t len,
+                   double fs_hz, uint32_t m_max, unsigned per_decade,
+                   unsigned threads);
+
+int imu_allan_push(struct imu_allan *a, const struct imu_block_f *b);
+// Processes what is still pending; call before reading the results.
+int imu_allan_flush(struct imu_allan *a);
+
+// Fills up to max (tau, adev) points for one axis, returns how many.
+unsigned imu_allan_curve(const struct imu_allan *a, unsigned axis,
+                         double *tau, double *adev, unsigned max);
+int imu_allan_noise(const struct imu_allan *a, unsigned axis,
+                    struct imu_allan_noise *out);
+
+#endif // IMU_ALLAN_H
@@ -0,0 +1,270 @@
+#include "imu_batch.h"
+#include "imu_clock.h"
+#include "imu_error.h"
+#include <string.h>
+
+struct worker_arg {
+  struct imu_batch *e;
+  unsigned self;
+};
+
+int imu_batch_init(struct imu_batch *e, const struct imu_batch_config *cfg) {
+  struct imu_block probe;
+
+  if (e == NULL || cfg == NULL)
+    return IMU_E_NULL_PTR;
+  // An empty block only has its remap checked.
+  probe.n = 0;
+  if (cfg->remap != NULL && imu_block_remap(&probe, cfg->remap) != IMU_OK)
+    return IMU_E_INVALID_INPUT;
+
+  memset(e, 0, sizeof(*e));
+  e->cfg = *cfg;
+  return IMU_OK;
+}
+
+int imu_batch_add(struct imu_batch *e, const struct imu_capture_reader *r,
+                  const struct imu_capture_chunk *chunks, size_t count) {
+  struct imu_batch_source *s;
+
+  if (e == NULL || r == NULL || (chunks == NULL && count > 0))
+    return IMU_E_NULL_PTR;
+  if (e->nsources == IMU_BATCH_MAX_SOURCES)
+    return IMU_E_FULL;
+
+  s = &e->src[e->nsources++];
+  s->r = r;
+  s->chunks = chunks;
+  s->count = count;
+  s->first = e->ntasks;
+  e->ntasks += count;
+  return IMU_OK;
+}
+
+static const struct imu_batch_source *source_of(const struct imu_batch *e,
+                                                size_t task) {
+  unsigned lo = 0, hi = e->nsources;
+
+  // Last source whose first task is at or before task.
+  while (hi - lo > 1) {
+    unsigned mid = (lo + hi) / 2;
+    if (e->src[mid].first <= task)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return &e->src[lo];
+}
+
+static void run_task(struct imu_batch *e, struct imu_batch_worker *w,
+                     unsigned self, size_t task) {
+  const struct imu_batch_config *cfg = &e->cfg;
+  const struct imu_batch_source *s = source_of(e, task);
+  struct imu_capture_reader sub;
+  struct imu_batch_out o;
+  int rslt;
+
+  o.worker = self;
+  o.source = (unsigned)(s - e->src);
+  o.chunk = task - s->first;
+  rslt = imu_capture_chunk_reader(s->r, &s->chunks[o.chunk], &sub);
+
+  w->have_accel = 0;
+  if (cfg->ahrs != NULL) {
+    for (unsigned d = 0; d < IMU_BATCH_MAX_DEVICES; d++)
+      imu_ahrs_init(&w->ahrs[d], cfg->ahrs);
+  }
+
+  while (rslt == IMU_OK &&
+         (rslt = imu_capture_next(&sub, &o.device, &o.kind, &w->blk)) ==
+             IMU_OK) {
+    const struct imu_calib_kernel *k =
+        o.kind == IMU_CAPTURE_ACCEL ? cfg->accel : cfg->gyro;
+
+    if (cfg->remap != NULL)
+      imu_block_remap(&w->blk, cfg->remap);
+    o.cal = NULL;
+    if (k != NULL) {
+      imu_calib_apply_block(k, &w->blk, &w->cal);
+      o.cal = &w->cal;
+    }
+
+    // Accel is held until the gyro block of the same device arrives.
+    o.q = NULL;
+    if (cfg->ahrs != NULL && o.device < IMU_BATCH_MAX_DEVICES) {
+      const unsigned bit = 1u << o.device;
+
+      if (o.kind == IMU_CAPTURE_ACCEL) {
+        w->accel[o.device] = w->blk;
+        w->have_accel |= bit;
+      } else if (w->have_accel & bit) {
+        imu_ahrs_update_block(&w->ahrs[o.device], &w->accel[o.device],
+                              &w->blk);
+        w->have_accel &= ~bit;
+        o.q = w->ahrs[o.device].q;
+      }
+    }
+
+    w->samples += w->blk.n;
+    o.raw = &w->blk;
+    if (cfg->sink != NULL)
+      cfg->sink(cfg->ctx, &o);
+  }
+
+  w->tasks++;
+  if (rslt != IMU_E_NOT_FOUND) {
+    if (w->failed++ == 0)
+      w->error = rslt;
+  }
+}
+
+// Moves the back half of the first non-empty range found into self's.
+static int steal(struct imu_batch *e, unsigned self) {
+  for (unsigned k = 1; k < e->threads; k++) {
+    struct imu_batch_worker *v = &e->w[(self + k) % e->threads];
+    size_t lo, hi;
+
+    pthread_mutex_lock(&v->lock);
+    hi = v->hi;
+    lo = hi - (hi - v->lo + 1) / 2;
+    v->hi = lo;
+    pthread_mutex_unlock(&v->lock);
+    if (lo == hi)
+      continue;
+
+    pthread_mutex_lock(&e->w[self].lock);
+    e->w[self].lo = lo;
+    e->w[self].hi = hi;
+    pthread_mutex_unlock(&e->w[self].lock);
+    e->w[self].stolen += hi - lo;
+    return 1;
+  }
+  return 0;
+}
+
+static void *run_worker(void *p) {
+  struct worker_arg *arg = p;
+  struct imu_batch *e = arg->e;
+  struct imu_batch_worker *w = &e->w[arg->self];
+  uint64_t start = imu_now_ns();
+
+  for (;;) {
+    size_t task = 0;
+    int have;
+
+    pthread_mutex_lock(&w->lock);
+    have = w->lo < w->hi;
+    if (have)
+      task = w->lo++;
+    pthread_mutex_unlock(&w->lock);
+
+    if (have)
+      run_task(e, w, arg->self, task);
+    else if (!steal(e, arg->self))
+      break;
+  }
+  w->busy_ns = imu_now_ns() - start;
+  return NULL;
+}
+
+int imu_batch_run(struct imu_batch *e, unsigned threads) {
+  struct worker_arg arg[IMU_BATCH_MAX_THREADS];
+  pthread_t tid[IMU_BATCH_MAX_THREADS];
+  unsigned started = 0;
+  uint64_t start;
+
+  if (e == NULL)
+    return IMU_E_NULL_PTR;
+  if (threads == 0 || threads > IMU_BATCH_MAX_THREADS)
+    return IMU_E_INVALID_INPUT;
+
+  e->threads = threads;
+  e->samples = 0;
+  e->failed = 0;
+  e->first_error = IMU_OK;
+  for (unsigned t = 0; t < threads; t++) {
+    struct imu_batch_worker *w = &e->w[t];
+
+    pthread_mutex_init(&w->lock, NULL);
+    w->lo = e->ntasks * t / threads;
+    w->hi = e->ntasks * (t + 1) / threads;
+    w->tasks = 0;
+    w->stolen = 0;
+    w->samples = 0;
+    w->busy_ns = 0;
+    w->failed = 0;
+    w->error = IMU_OK;
+    arg[t].e = e;
+    arg[t].self = t;
+  }
+
+  start = imu_now_ns();
+  for (unsigned t = 1; t < threads; t++) {
+    if (pthread_create(&tid[t], NULL, run_worker, &arg[t]) != 0)
+      break;
+    started = t;
+  }
+  // A worker that did not get a thread has its range stolen.
+  run_worker(&arg[0]);
+  for (unsigned t = 1; t <= started; t++)
+    pthread_join(tid[t], NULL);
+  e->wall_ns = imu_now_ns() - start;
+
+  for (unsigned t = 0; t < threads; t++) {
+    struct imu_batch_worker *w = &e->w[t];
+
+    pthread_mutex_destroy(&w->lock);
+    e->samples += w->samples;
+    if (w->failed != 0 && e->failed == 0)
+      e->first_error = w->error;
+    e->failed += w->failed;
+  }
+  return e->failed == 0 ? IMU_OK : IMU_E_FORMAT;
+}
+
+double imu_batch_samples_per_s(const struct imu_batch *e) {
+  return e->wall_ns ? (double)e->samples * 1e9 / (double)e->wall_ns : 0.0;
+}
+
+void imu_batch_report(const struct imu_batch *e, FILE *out) {
+  fprintf(out, "%-6s %8s %8s %12s %10s\n", "worker", "tasks", "stolen",
+          "samples", "busy_ms");
+  for (unsigned t = 0; t < e->threads; t++) {
+    const struct imu_batch_worker *w = &e->w[t];
+    fprintf(out, "%-6u %8llu %8llu %12llu %10.3f\n", t,
+            (unsigned long long)w->tasks, (unsigned long long)w->stolen,
+            (unsigned long long)w->samples, w->busy_ns / 1e6);
+  }
+  fprintf(out, "%zu chunks, %llu samples in %.3f ms: %.0f samples/s",
+          e->ntasks, (unsigned long long)e->samples, e->wall_ns / 1e6,
+          imu_batch_samples_per_s(e));
+  if (e->failed != 0)
+    fprintf(out, ", %llu chunks failed (%d)", (unsigned long long)e->failed,
+            e->first_error);
+  fprintf(out, "\n");
+}
+
+int imu_batch_scaling(struct imu_batch *e, unsigned max_threads, FILE *out) {
+  double base = 0.0;
+  int rslt = IMU_OK;
+
+  if (e == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  if (max_threads == 0 || max_threads > IMU_BATCH_MAX_THREADS)
+    return IMU_E_INVALID_INPUT;
+
+  fprintf(out, "%-7s %14s %8s\n", "threads", "samples/s", "speedup");
+  for (unsigned t = 1;; t = t * 2 < max_threads ? t * 2 : max_threads) {
+    double rate;
+
+    rslt = imu_batch_run(e, t);
+    rate = imu_batch_samples_per_s(e);
+    if (t == 1)
+      base = rate;
+    fprintf(out, "%-7u %14.0f %7.2fx\n", t, rate,
+            base > 0.0 ? rate / base : 0.0);
+    if (t == max_threads)
+      break;
+  }
+  return rslt;
+}
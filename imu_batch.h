@@ -0,0 +1,101 @@
+#ifndef IMU_BATCH_H
+#define IMU_BATCH_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "imu_ahrs.h"
+#include "imu_block.h"
+#include "imu_calib.h"
+#include "imu_capture.h"
+
+// Offline reprocessing of capture archives. Every indexed chunk of every
+// added capture is one task: its blocks are decoded, remapped, calibrated
+// and fused with the same block functions the live path uses. Tasks are
+// dealt to the workers as contiguous ranges; a worker takes from the
+// front of its own range and, once that is empty, steals the back half of
+// another worker's. Chunks decode on their own, so fusion starts from a
+// fresh estimator per chunk and device. Link with -lpthread.
+
+#define IMU_BATCH_MAX_SOURCES 64
+#define IMU_BATCH_MAX_THREADS 16
+#define IMU_BATCH_MAX_DEVICES 4 // devices fused per chunk; others skip it
+
+struct imu_batch_out {
+  unsigned worker;
+  unsigned source;
+  size_t chunk;
+  uint16_t device;
+  enum imu_capture_kind kind;
+  const struct imu_block *raw;   // after remap
+  const struct imu_block_f *cal; // NULL without a kernel for kind
+  const float *q;                // after fusing this gyro block, else NULL
+};
+
+struct imu_batch_config {
+  const struct bmi08_axes_remap *remap; // NULL: keep the sensor frame
+  const struct imu_calib_kernel *accel; // NULL: no calibration
+  const struct imu_calib_kernel *gyro;
+  const struct imu_ahrs_config *ahrs; // NULL: no fusion
+  // Called from the worker threads for every block; may be NULL.
+  void (*sink)(void *ctx, const struct imu_batch_out *o);
+  void *ctx;
+};
+
+struct imu_batch_source {
+  const struct imu_capture_reader *r;
+  const struct imu_capture_chunk *chunks;
+  size_t count;
+  size_t first; // task id of chunks[0]
+};
+
+struct imu_batch_worker {
+  pthread_mutex_t lock;
+  size_t lo, hi; // tasks still owned
+  uint64_t tasks;
+  uint64_t stolen; // tasks taken from other workers
+  uint64_t samples;
+  uint64_t busy_ns;
+  uint64_t failed;
+  int error;
+  struct imu_block blk;
+  struct imu_block_f cal;
+  struct imu_block accel[IMU_BATCH_MAX_DEVICES];
+  unsigned have_accel;
+  struct imu_ahrs ahrs[IMU_BATCH_MAX_DEVICES];
+};
+
+struct imu_batch {
+  struct imu_batch_config cfg;
+  unsigned nsources;
+  size_t ntasks;
+  struct imu_batch_source src[IMU_BATCH_MAX_SOURCES];
+  // Results of the last run.
+  unsigned threads;
+  uint64_t wall_ns;
+  uint64_t samples;
+  uint64_t failed; // chunks that did not decode to the end
+  int first_error;
+  struct imu_batch_worker w[IMU_BATCH_MAX_THREADS];
+};
+
+int imu_batch_init(struct imu_batch *e, const struct imu_batch_config *cfg);
+// Adds a capture and its index (see imu_capture_index); both have to stay
+// valid until the last run.
+int imu_batch_add(struct imu_batch *e, const struct imu_capture_reader *r,
+                  const struct imu_capture_chunk *chunks, size_t count);
+// Processes every task once on threads workers, the caller being one of
+// them. IMU_E_FORMAT when a chunk failed; the others still run.
+int imu_batch_run(struct imu_batch *e, unsigned threads);
+
+double imu_batch_samples_per_s(const struct imu_batch *e);
+// Per-worker breakdown of the last run.
+void imu_batch_report(const struct imu_batch *e, FILE *out);
+// Runs the whole batch at 1, 2, 4 ... max_threads workers and prints
+// samples/s and speedup over one worker for each. The sink sees every
+// run.
+int imu_batch_scaling(struct imu_batch *e, unsigned max_threads, FILE *out);
+
+#endif // IMU_BATCH_H
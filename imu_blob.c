@@ -0,0 +1,109 @@
+#include "imu_blob.h"
+#include "bmi08_defs.h"
+#include "imu_error.h"
+#include <stdio.h>
+
+#define MAX_LITERAL 128u
+#define MAX_RUN (BMI08_CONFIG_RLE_COUNT_MASK + BMI08_CONFIG_RLE_MIN_RUN)
+
+// Longest run at pos that repeats the bytes period positions back.
+static uint32_t run_length(const uint8_t *raw, uint32_t len, uint32_t pos,
+                           uint32_t period) {
+  uint32_t n = 0;
+
+  while (pos + n < len && n < MAX_RUN && raw[pos + n] == raw[pos + n - period])
+    n++;
+  return n;
+}
+
+static int put(uint8_t *out, uint32_t cap, uint32_t *n, uint8_t v) {
+  if (*n == cap)
+    return IMU_E_FULL;
+  out[(*n)++] = v;
+  return IMU_OK;
+}
+
+static int flush_literal(const uint8_t *lit, uint32_t count, uint8_t *out,
+                         uint32_t cap, uint32_t *n) {
+  int rslt = IMU_OK;
+
+  if (count == 0)
+    return IMU_OK;
+  rslt = put(out, cap, n, (uint8_t)(count - 1));
+  for (uint32_t i = 0; i < count && rslt == IMU_OK; i++)
+    rslt = put(out, cap, n, lit[i]);
+  return rslt;
+}
+
+int imu_blob_pack(const uint8_t *raw, uint32_t len, uint8_t *out,
+                  uint32_t cap, uint32_t *out_len) {
+  uint32_t pos = 0, lit = 0, n = 0;
+  int rslt = IMU_OK;
+
+  if (raw == NULL || out == NULL || out_len == NULL)
+    return IMU_E_NULL_PTR;
+  if (len > BMI08_CONFIG_STREAM_SIZE)
+    return IMU_E_INVALID_INPUT;
+
+  while (len > 0 && raw[len - 1] == 0)
+    len--;
+
+  while (pos < len && rslt == IMU_OK) {
+    uint32_t best = 0, best_period = 0;
+
+    for (uint32_t p = 1; p <= BMI08_CONFIG_RLE_HIST && p <= pos; p++) {
+      uint32_t r = run_length(raw, len, pos, p);
+      if (r > best) {
+        best = r;
+        best_period = p;
+      }
+    }
+
+    if (best >= BMI08_CONFIG_RLE_MIN_RUN) {
+      rslt = flush_literal(raw + pos - lit, lit, out, cap, &n);
+      lit = 0;
+      if (rslt == IMU_OK)
+        rslt = put(out, cap, &n,
+                   (uint8_t)(BMI08_CONFIG_RLE_REPEAT |
+                             ((best_period - 1)
+                              << BMI08_CONFIG_RLE_PERIOD_POS) |
+                             (best - BMI08_CONFIG_RLE_MIN_RUN)));
+      pos += best;
+    } else {
+      lit++;
+      pos++;
+      if (lit == MAX_LITERAL) {
+        rslt = flush_literal(raw + pos - lit, lit, out, cap, &n);
+        lit = 0;
+      }
+    }
+  }
+  if (rslt == IMU_OK)
+    rslt = flush_literal(raw + pos - lit, lit, out, cap, &n);
+
+  *out_len = n;
+  return rslt;
+}
+
+int imu_blob_write_c(const uint8_t *packed, uint32_t len, const char *name,
+                     const char *path) {
+  FILE *f;
+  int ok;
+
+  if (packed == NULL || name == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  f = fopen(path, "w");
+  if (f == NULL)
+    return IMU_E_IO;
+  fprintf(f, "const uint8_t %s[] = {", name);
+  for (uint32_t i = 0; i < len; i++)
+    fprintf(f, "%s0x%02x%s", i % 19 == 0 ? "\n    " : " ", packed[i],
+            i + 1 < len ? "," : "");
+  fprintf(f, "\n};\n");
+  ok = !ferror(f);
+  if (fclose(f) != 0)
+    ok = 0;
+
+  return ok ? IMU_OK : IMU_E_IO;
+}
@@ -0,0 +1,19 @@
+#ifndef IMU_BLOB_H
+#define IMU_BLOB_H
+
+#include <stdint.h>
+
+// Host-side packer for accel config blobs, producing the token stream that
+// bmi08a_config_stream_read unpacks (see BMI08_CONFIG_RLE_* in
+// bmi08_defs.h). Trailing zeros are dropped since the reader zero-fills.
+// Assign the result to dev->config_file_ptr with dev->config_file_size set
+// to *out_len.
+int imu_blob_pack(const uint8_t *raw, uint32_t len, uint8_t *out,
+                  uint32_t cap, uint32_t *out_len);
+
+// Writes a packed blob as a C array definition, 19 bytes per line as in
+// the driver sources.
+int imu_blob_write_c(const uint8_t *packed, uint32_t len, const char *name,
+                     const char *path);
+
+#endif // IMU_BLOB_H
@@ -0,0 +1,189 @@
+#include "imu_block.h"
+#include "imu_error.h"
+#include "imu_sync.h"
+#include <string.h>
+
+static inline int16_t le16(const uint8_t *d) {
+  return (int16_t)((uint16_t)d[1] << 8 | d[0]);
+}
+
+static uint64_t stamp(struct imu_block_clock *clk) {
+  uint64_t t = clk->next_ns;
+  clk->next_ns += clk->period_ns;
+  return t;
+}
+
+void imu_block_clear(struct imu_block *b) { b->n = 0; }
+
+int imu_block_from_aos(struct imu_block *b, const struct bmi08_sensor_data *in,
+                       size_t n, struct imu_block_clock *clk) {
+  size_t room, take, base;
+
+  if (b == NULL || clk == NULL || (in == NULL && n > 0))
+    return IMU_E_NULL_PTR;
+
+  room = IMU_BLOCK_CAP - b->n;
+  take = n < room ? n : room;
+  base = b->n;
+  for (size_t i = 0; i < take; i++) {
+    b->x[base + i] = in[i].x;
+    b->y[base + i] = in[i].y;
+    b->z[base + i] = in[i].z;
+  }
+  for (size_t i = 0; i < take; i++)
+    b->t[base + i] = clk->next_ns + (uint64_t)i * clk->period_ns;
+  clk->next_ns += (uint64_t)take * clk->period_ns;
+  b->n += take;
+
+  return take < n ? IMU_E_FULL : IMU_OK;
+}
+
+void imu_block_to_aos(const struct imu_block *b,
+                      struct bmi08_sensor_data *out) {
+  for (size_t i = 0; i < b->n; i++) {
+    out[i].x = b->x[i];
+    out[i].y = b->y[i];
+    out[i].z = b->z[i];
+  }
+}
+
+// Same frame grammar as the driver's header-mode parser: a frame cut off at
+// the end of the buffer or an unknown header ends the data.
+int imu_block_from_accel_fifo(struct imu_block *b,
+                              struct bmi08_fifo_frame *fifo,
+                              struct imu_block_clock *clk) {
+  const uint8_t *d;
+  uint16_t idx, len;
+
+  if (b == NULL || fifo == NULL || fifo->data == NULL || clk == NULL)
+    return IMU_E_NULL_PTR;
+
+  d = fifo->data;
+  len = fifo->length;
+  idx = fifo->acc_byte_start_idx;
+  while (idx < len && b->n < IMU_BLOCK_CAP) {
+    uint8_t header = d[idx++];
+
+    switch (header) {
+    case BMI08_FIFO_HEADER_ACC_FRM:
+      if (idx + BMI08_FIFO_ACCEL_LENGTH > len) {
+        idx = len;
+        break;
+      }
+      b->x[b->n] = le16(&d[idx]);
+      b->y[b->n] = le16(&d[idx + 2]);
+      b->z[b->n] = le16(&d[idx + 4]);
+      b->t[b->n] = stamp(clk);
+      b->n++;
+      idx += BMI08_FIFO_ACCEL_LENGTH;
+      break;
+    case BMI08_FIFO_HEADER_SENS_TIME_FRM:
+      if (idx + BMI08_SENSOR_TIME_LENGTH > len) {
+        idx = len;
+        break;
+      }
+      fifo->sensor_time = (uint32_t)d[idx] | (uint32_t)d[idx + 1] << 8 |
+                          (uint32_t)d[idx + 2] << 16;
+      idx += BMI08_SENSOR_TIME_LENGTH;
+      break;
+    case BMI08_FIFO_HEADER_SKIP_FRM:
+      if (idx + BMI08_FIFO_SKIP_FRM_LENGTH > len) {
+        idx = len;
+        break;
+      }
+      fifo->skipped_frame_count = d[idx];
+      clk->next_ns += (uint64_t)d[idx] * clk->period_ns;
+      idx += BMI08_FIFO_SKIP_FRM_LENGTH;
+      break;
+    case BMI08_FIFO_HEADER_INPUT_CFG_FRM:
+    case BMI08_FIFO_SAMPLE_DROP_FRM:
+      idx += BMI08_FIFO_INPUT_CFG_LENGTH;
+      break;
+    default:
+      // Over-read marker (0x80) or garbage.
+      idx = len;
+      break;
+    }
+  }
+  fifo->acc_byte_start_idx = idx < len ? idx : len;
+
+  return fifo->acc_byte_start_idx < len ? IMU_E_FULL : IMU_OK;
+}
+
+int imu_block_from_gyro_fifo(struct imu_block *b, struct bmi08_fifo_frame *fifo,
+                             struct imu_block_clock *clk) {
+  return imu_block_from_gyro_fifo_sync(b, fifo, clk, NULL);
+}
+
+int imu_block_from_gyro_fifo_sync(struct imu_block *b,
+                                  struct bmi08_fifo_frame *fifo,
+                                  struct imu_block_clock *clk,
+                                  struct imu_sync_index *sync) {
+  const struct bmi08_gyr_fifo_config *conf;
+  const uint8_t *d;
+  uint16_t idx, len, frame;
+
+  if (b == NULL || fifo == NULL || fifo->data == NULL || clk == NULL)
+    return IMU_E_NULL_PTR;
+
+  conf = &fifo->gyr_fifo_conf;
+  if (conf->data_select != BMI08_GYRO_FIFO_XYZ_AXIS_ENABLED)
+    return IMU_E_INVALID_INPUT;
+
+  // Tagged frames carry two trailing ext-sync bytes after x, y, z.
+  frame = BMI08_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE + (conf->tag ? 2 : 0);
+  d = fifo->data;
+  len = fifo->length;
+  idx = fifo->gyr_byte_start_idx;
+  while (idx + frame <= len && b->n < IMU_BLOCK_CAP) {
+    b->x[b->n] = le16(&d[idx]);
+    b->y[b->n] = le16(&d[idx + 2]);
+    b->z[b->n] = le16(&d[idx + 4]);
+    b->t[b->n] = stamp(clk);
+    if (conf->tag && sync != NULL)
+      imu_sync_note(sync, (uint16_t)le16(&d[idx + 6]), b->t[b->n]);
+    b->n++;
+    idx += frame;
+  }
+  fifo->gyr_byte_start_idx = idx;
+
+  return idx + frame <= len ? IMU_E_FULL : IMU_OK;
+}
+
+int imu_block_remap(struct imu_block *b, const struct bmi08_axes_remap *r) {
+  _Alignas(IMU_BLOCK_ALIGN) int16_t src[3][IMU_BLOCK_CAP];
+  int16_t *const lane[3] = {b->x, b->y, b->z};
+  const uint8_t axis[3] = {r->x_axis, r->y_axis, r->z_axis};
+  const uint8_t sign[3] = {r->x_axis_sign, r->y_axis_sign, r->z_axis_sign};
+  const size_t n = b->n;
+
+  for (int a = 0; a < 3; a++) {
+    if (axis[a] > 2 || sign[a] > 1)
+      return IMU_E_INVALID_INPUT;
+  }
+
+  for (int a = 0; a < 3; a++)
+    memcpy(src[a], lane[a], n * sizeof(int16_t));
+  for (int a = 0; a < 3; a++) {
+    const int16_t *restrict s = src[axis[a]];
+    int16_t *restrict o = lane[a];
+    const int16_t m = sign[a] ? -1 : 1;
+    for (size_t i = 0; i < n; i++)
+      o[i] = (int16_t)(s[i] * m);
+  }
+  return IMU_OK;
+}
+
+void imu_block_convert(const struct imu_block *in, const float scale[3],
+                       struct imu_block_f *out) {
+  const float sx = scale[0], sy = scale[1], sz = scale[2];
+  const size_t n = in->n;
+
+  for (size_t i = 0; i < n; i++) {
+    out->x[i] = (float)in->x[i] * sx;
+    out->y[i] = (float)in->y[i] * sy;
+    out->z[i] = (float)in->z[i] * sz;
+  }
+  memcpy(out->t, in->t, n * sizeof(uint64_t));
+  out->n = n;
+}
@@ -0,0 +1,77 @@
+#ifndef IMU_BLOCK_H
+#define IMU_BLOCK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+
+// Structure-of-arrays sample block. The driver hands out bmi08_sensor_data
+// (x, y, z interleaved on a 6-byte stride); here every axis is its own
+// cache-line aligned lane, so per-axis kernels load full vectors without
+// shuffles and IMU_BLOCK_CAP matches IMU_FILTER_MAX_BLOCK.
+
+struct imu_sync_index;
+
+#define IMU_BLOCK_CAP 256
+#define IMU_BLOCK_ALIGN 64
+
+struct imu_block {
+  _Alignas(IMU_BLOCK_ALIGN) int16_t x[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t y[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t z[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) uint64_t t[IMU_BLOCK_CAP]; // ns
+  size_t n;
+};
+
+// Converted or filtered samples in physical units.
+struct imu_block_f {
+  _Alignas(IMU_BLOCK_ALIGN) float x[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) float y[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) float z[IMU_BLOCK_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) uint64_t t[IMU_BLOCK_CAP];
+  size_t n;
+};
+
+// Stamps samples as they are appended: the k-th one gets next_ns and the
+// clock advances by period_ns per sample, including frames the FIFO
+// reports as skipped, so gaps stay visible in t.
+struct imu_block_clock {
+  uint64_t next_ns;
+  uint32_t period_ns;
+};
+
+void imu_block_clear(struct imu_block *b);
+
+// The append functions add up to IMU_BLOCK_CAP - b->n samples and return
+// IMU_E_FULL when input was left over.
+int imu_block_from_aos(struct imu_block *b, const struct bmi08_sensor_data *in,
+                       size_t n, struct imu_block_clock *clk);
+void imu_block_to_aos(const struct imu_block *b, struct bmi08_sensor_data *out);
+
+// Parse FIFO bytes read by bmi08a_read_fifo_data / bmi08g_read_fifo_data
+// straight into the lanes. Both resume from fifo->acc_byte_start_idx or
+// fifo->gyr_byte_start_idx, so a FIFO larger than one block is drained by
+// calling again with a fresh block. The accel parser also updates
+// fifo->sensor_time and fifo->skipped_frame_count like the driver does.
+int imu_block_from_accel_fifo(struct imu_block *b,
+                              struct bmi08_fifo_frame *fifo,
+                              struct imu_block_clock *clk);
+int imu_block_from_gyro_fifo(struct imu_block *b, struct bmi08_fifo_frame *fifo,
+                             struct imu_block_clock *clk);
+// Same, also passing each frame's ext-sync tag to sync when the FIFO tag
+// is enabled (see imu_sync.h).
+int imu_block_from_gyro_fifo_sync(struct imu_block *b,
+                                  struct bmi08_fifo_frame *fifo,
+                                  struct imu_block_clock *clk,
+                                  struct imu_sync_index *sync);
+
+// Applies an axis remap in place. Axis fields are 0..2 (x, y, z) and signs
+// 0 positive, 1 negative, as in bmi08_dev.remap.
+int imu_block_remap(struct imu_block *b, const struct bmi08_axes_remap *r);
+
+// out = raw * scale per axis; t is copied.
+void imu_block_convert(const struct imu_block *in, const float scale[3],
+                       struct imu_block_f *out);
+
+#endif // IMU_BLOCK_H
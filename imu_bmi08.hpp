@@ -0,0 +1,348 @@
+#ifndef IMU_BMI08_HPP
+#define IMU_BMI08_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+#include "bmi08.h"
+
+// Header-only C++17 facade over the BMI08x driver.
+//
+// A Bmi08Device owns its two bus handles and the bmi08_dev that points at
+// them, so it is move-only: moving it re-points the driver at the moved
+// buses. Register reads through the facade go straight to the bus with the
+// same transaction the C path issues, minus the pointer checks, which
+// cannot fail for an object that exists (they remain as asserts in debug
+// builds). Everything else forwards to the C driver.
+//
+// A Bus is any movable type providing
+//   int8_t read(uint8_t reg, uint8_t *data, uint32_t len);
+//   int8_t write(uint8_t reg, const uint8_t *data, uint32_t len);
+//   void delay_us(uint32_t us);
+// where a non-zero return is a bus failure, and optionally
+//   int8_t write_seq(const bmi08_reg_write *seq, uint32_t count);
+// to take gyro multi-register writes as one sequence.
+
+namespace imu {
+
+#if defined(__cpp_lib_span)
+template <class T> using span = std::span<T>;
+#else
+// The subset of std::span the facade needs, for C++17.
+template <class T> class span {
+public:
+  constexpr span() noexcept = default;
+  constexpr span(T *data, std::size_t size) noexcept
+      : data_(data), size_(size) {}
+  template <std::size_t N>
+  constexpr span(T (&arr)[N]) noexcept : data_(arr), size_(N) {}
+  template <class C, class = decltype(std::declval<C &>().data()),
+            class = decltype(std::declval<C &>().size())>
+  constexpr span(C &c) noexcept : data_(c.data()), size_(c.size()) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr T &operator[](std::size_t i) const noexcept { return data_[i]; }
+  constexpr T *begin() const noexcept { return data_; }
+  constexpr T *end() const noexcept { return data_ + size_; }
+  constexpr span subspan(std::size_t offset, std::size_t count) const noexcept {
+    return span(data_ + offset, count);
+  }
+
+private:
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+#endif
+
+enum class Status : int8_t {
+  ok = BMI08_OK,
+  null_ptr = BMI08_E_NULL_PTR,
+  com_fail = BMI08_E_COM_FAIL,
+  dev_not_found = BMI08_E_DEV_NOT_FOUND,
+  out_of_range = BMI08_E_OUT_OF_RANGE,
+  invalid_input = BMI08_E_INVALID_INPUT,
+  config_stream_error = BMI08_E_CONFIG_STREAM_ERROR,
+  rd_wr_length_invalid = BMI08_E_RD_WR_LENGTH_INVALID,
+  invalid_config = BMI08_E_INVALID_CONFIG,
+  feature_not_supported = BMI08_E_FEATURE_NOT_SUPPORTED,
+  self_test_fail = BMI08_E_SELF_TEST_FAIL,
+};
+
+constexpr Status to_status(int8_t rslt) noexcept {
+  return static_cast<Status>(rslt);
+}
+
+enum class Sensor : uint8_t { accel, gyro };
+
+// Compile-time register descriptor: owning sensor, address and the length
+// of the natural burst starting there.
+struct Reg {
+  Sensor sensor;
+  uint8_t addr;
+  uint8_t len;
+};
+
+namespace reg {
+inline constexpr Reg accel_chip_id{Sensor::accel, BMI08_REG_ACCEL_CHIP_ID, 1};
+inline constexpr Reg accel_err{Sensor::accel, BMI08_REG_ACCEL_ERR, 1};
+inline constexpr Reg accel_status{Sensor::accel, BMI08_REG_ACCEL_STATUS, 1};
+inline constexpr Reg accel_data{Sensor::accel, BMI08_REG_ACCEL_X_LSB, 6};
+inline constexpr Reg accel_sensortime{Sensor::accel,
+                                      BMI08_REG_ACCEL_SENSORTIME_0, 3};
+inline constexpr Reg accel_internal_stat{Sensor::accel,
+                                         BMI08_REG_ACCEL_INTERNAL_STAT, 1};
+inline constexpr Reg temperature{Sensor::accel, BMI08_REG_TEMP_MSB, 2};
+inline constexpr Reg accel_conf{Sensor::accel, BMI08_REG_ACCEL_CONF, 2};
+inline constexpr Reg accel_range{Sensor::accel, BMI08_REG_ACCEL_RANGE, 1};
+inline constexpr Reg accel_pwr_conf{Sensor::accel, BMI08_REG_ACCEL_PWR_CONF, 1};
+inline constexpr Reg accel_pwr_ctrl{Sensor::accel, BMI08_REG_ACCEL_PWR_CTRL, 1};
+
+inline constexpr Reg gyro_chip_id{Sensor::gyro, BMI08_REG_GYRO_CHIP_ID, 1};
+inline constexpr Reg gyro_data{Sensor::gyro, BMI08_REG_GYRO_X_LSB, 6};
+inline constexpr Reg gyro_range{Sensor::gyro, BMI08_REG_GYRO_RANGE, 1};
+inline constexpr Reg gyro_bandwidth{Sensor::gyro, BMI08_REG_GYRO_BANDWIDTH, 1};
+inline constexpr Reg gyro_lpm1{Sensor::gyro, BMI08_REG_GYRO_LPM1, 1};
+} // namespace reg
+
+template <class Bus> class Bmi08Accel;
+template <class Bus> class Bmi08Gyro;
+
+template <class B, class = void> struct has_write_seq : std::false_type {};
+template <class B>
+struct has_write_seq<B, std::void_t<decltype(std::declval<B &>().write_seq(
+                            std::declval<const bmi08_reg_write *>(),
+                            uint32_t{}))>> : std::true_type {};
+
+template <class Bus> class Bmi08Device {
+public:
+  Bmi08Device(Bus accel_bus, Bus gyro_bus, bmi08_intf intf,
+              bmi08_variant variant)
+      : accel_bus_(std::move(accel_bus)), gyro_bus_(std::move(gyro_bus)) {
+    dev_.intf = intf;
+    dev_.variant = variant;
+    dev_.read_write_len = 32;
+    dev_.accel_cfg.power = BMI08_ACCEL_PM_SUSPEND;
+    bind();
+  }
+
+  Bmi08Device(const Bmi08Device &) = delete;
+  Bmi08Device &operator=(const Bmi08Device &) = delete;
+
+  Bmi08Device(Bmi08Device &&other) noexcept
+      : accel_bus_(std::move(other.accel_bus_)),
+        gyro_bus_(std::move(other.gyro_bus_)), dev_(other.dev_) {
+    bind();
+  }
+
+  Bmi08Device &operator=(Bmi08Device &&other) noexcept {
+    accel_bus_ = std::move(other.accel_bus_);
+    gyro_bus_ = std::move(other.gyro_bus_);
+    dev_ = other.dev_;
+    bind();
+    return *this;
+  }
+
+  Bmi08Accel<Bus> accel() noexcept { return Bmi08Accel<Bus>(*this); }
+  Bmi08Gyro<Bus> gyro() noexcept { return Bmi08Gyro<Bus>(*this); }
+
+  // Chip ids of both sensors; also selects the SPI dummy byte.
+  [[nodiscard]] Status init() noexcept {
+    int8_t rslt = bmi08a_init(&dev_);
+    if (rslt == BMI08_OK)
+      rslt = bmi08g_init(&dev_);
+    return to_status(rslt);
+  }
+
+  // For driver APIs the facade does not wrap.
+  bmi08_dev &raw() noexcept { return dev_; }
+  const bmi08_dev &raw() const noexcept { return dev_; }
+
+  Bus &accel_bus() noexcept { return accel_bus_; }
+  Bus &gyro_bus() noexcept { return gyro_bus_; }
+
+private:
+  friend class Bmi08Accel<Bus>;
+  friend class Bmi08Gyro<Bus>;
+
+  static BMI08_INTF_RET_TYPE read_cb(uint8_t reg, uint8_t *data, uint32_t len,
+                                     void *intf_ptr) {
+    return static_cast<Bus *>(intf_ptr)->read(reg, data, len);
+  }
+
+  static BMI08_INTF_RET_TYPE write_cb(uint8_t reg, const uint8_t *data,
+                                      uint32_t len, void *intf_ptr) {
+    return static_cast<Bus *>(intf_ptr)->write(reg, data, len);
+  }
+
+  static BMI08_INTF_RET_TYPE write_seq_cb(const bmi08_reg_write *seq,
+                                          uint32_t count, void *intf_ptr) {
+    return static_cast<Bus *>(intf_ptr)->write_seq(seq, count);
+  }
+
+  static void delay_cb(uint32_t us, void *intf_ptr) {
+    static_cast<Bus *>(intf_ptr)->delay_us(us);
+  }
+
+  void bind() noexcept {
+    dev_.read = read_cb;
+    dev_.write = write_cb;
+    if constexpr (has_write_seq<Bus>::value)
+      dev_.write_seq = write_seq_cb;
+    else
+      dev_.write_seq = nullptr;
+    dev_.delay_us = delay_cb;
+    dev_.intf_ptr_accel = &accel_bus_;
+    dev_.intf_ptr_gyro = &gyro_bus_;
+  }
+
+  Bus accel_bus_;
+  Bus gyro_bus_;
+  bmi08_dev dev_{};
+};
+
+inline bmi08_sensor_data unpack_xyz(const uint8_t *d) noexcept {
+  bmi08_sensor_data s;
+  s.x = static_cast<int16_t>(static_cast<uint16_t>(d[1] << 8 | d[0]));
+  s.y = static_cast<int16_t>(static_cast<uint16_t>(d[3] << 8 | d[2]));
+  s.z = static_cast<int16_t>(static_cast<uint16_t>(d[5] << 8 | d[4]));
+  return s;
+}
+
+// Non-owning view of the accel half of a device.
+template <class Bus> class Bmi08Accel {
+public:
+  explicit Bmi08Accel(Bmi08Device<Bus> &dev) noexcept : d_(&dev) {}
+
+  // Burst read of out.size() bytes from r.addr, one bus transaction.
+  [[nodiscard]] Status read(const Reg &r, span<uint8_t> out) noexcept {
+    bmi08_dev &dev = d_->dev_;
+    uint8_t buf[BMI08_MAX_LEN];
+    uint8_t addr = r.addr;
+    const uint32_t skip = dev.dummy_byte;
+
+    assert(r.sensor == Sensor::accel);
+    if (out.size() + skip > sizeof(buf))
+      return Status::rd_wr_length_invalid;
+    if (dev.intf == BMI08_SPI_INTF)
+      addr |= BMI08_SPI_RD_MASK;
+    if (d_->accel_bus_.read(addr, buf,
+                            static_cast<uint32_t>(out.size() + skip)) != 0)
+      return Status::com_fail;
+    for (std::size_t i = 0; i < out.size(); i++)
+      out[i] = buf[i + skip];
+    return Status::ok;
+  }
+
+  // Writes keep the driver's post-write delay for the current power mode.
+  [[nodiscard]] Status write(const Reg &r, span<const uint8_t> in) noexcept {
+    assert(r.sensor == Sensor::accel);
+    return to_status(bmi08a_get_set_regs(
+        r.addr, const_cast<uint8_t *>(in.data()),
+        static_cast<uint32_t>(in.size()), &d_->dev_, SET_FUNC));
+  }
+
+  [[nodiscard]] Status data(bmi08_sensor_data &out) noexcept {
+    uint8_t d[reg::accel_data.len];
+    Status s = read(reg::accel_data, d);
+    if (s == Status::ok)
+      out = unpack_xyz(d);
+    return s;
+  }
+
+  [[nodiscard]] Status soft_reset() noexcept {
+    return to_status(bmi08a_soft_reset(&d_->dev_));
+  }
+
+  // config_size is 0 for a plain image, else the packed stream length.
+  [[nodiscard]] Status load_config(const uint8_t *config,
+                                   uint16_t config_size) noexcept {
+    d_->dev_.config_file_ptr = config;
+    d_->dev_.config_file_size = config_size;
+    return to_status(bmi08a_load_config_file(&d_->dev_));
+  }
+
+  [[nodiscard]] Status set_power(uint8_t power) noexcept {
+    d_->dev_.accel_cfg.power = power;
+    return to_status(bmi08a_set_power_mode(&d_->dev_));
+  }
+
+  [[nodiscard]] Status configure(uint8_t odr, uint8_t bw,
+                                 uint8_t range) noexcept {
+    uint8_t r = range;
+    d_->dev_.accel_cfg.odr = odr;
+    d_->dev_.accel_cfg.bw = bw;
+    d_->dev_.accel_cfg.range = range;
+    Status s = to_status(bmi08a_set_meas_conf(&d_->dev_));
+    if (s == Status::ok)
+      s = write(reg::accel_range, span<const uint8_t>(&r, 1));
+    return s;
+  }
+
+private:
+  Bmi08Device<Bus> *d_;
+};
+
+// Non-owning view of the gyro half of a device. Gyro reads have no dummy
+// byte, so they land in the caller's buffer directly.
+template <class Bus> class Bmi08Gyro {
+public:
+  explicit Bmi08Gyro(Bmi08Device<Bus> &dev) noexcept : d_(&dev) {}
+
+  [[nodiscard]] Status read(const Reg &r, span<uint8_t> out) noexcept {
+    uint8_t addr = r.addr;
+
+    assert(r.sensor == Sensor::gyro);
+    if (d_->dev_.intf == BMI08_SPI_INTF)
+      addr |= BMI08_SPI_RD_MASK;
+    if (d_->gyro_bus_.read(addr, out.data(),
+                           static_cast<uint32_t>(out.size())) != 0)
+      return Status::com_fail;
+    return Status::ok;
+  }
+
+  [[nodiscard]] Status write(const Reg &r, span<const uint8_t> in) noexcept {
+    assert(r.sensor == Sensor::gyro);
+    return to_status(bmi08g_set_regs(r.addr, const_cast<uint8_t *>(in.data()),
+                                     static_cast<uint32_t>(in.size()),
+                                     &d_->dev_));
+  }
+
+  [[nodiscard]] Status data(bmi08_sensor_data &out) noexcept {
+    uint8_t d[reg::gyro_data.len];
+    Status s = read(reg::gyro_data, d);
+    if (s == Status::ok)
+      out = unpack_xyz(d);
+    return s;
+  }
+
+  [[nodiscard]] Status soft_reset() noexcept {
+    return to_status(bmi08g_soft_reset(&d_->dev_));
+  }
+
+  [[nodiscard]] Status set_power(uint8_t power) noexcept {
+    d_->dev_.gyro_cfg.power = power;
+    return to_status(bmi08g_set_power_mode(&d_->dev_));
+  }
+
+  [[nodiscard]] Status configure(uint8_t odr, uint8_t range) noexcept {
+    d_->dev_.gyro_cfg.odr = odr;
+    d_->dev_.gyro_cfg.range = range;
+    return to_status(bmi08g_set_meas_conf(&d_->dev_));
+  }
+
+private:
+  Bmi08Device<Bus> *d_;
+};
+
+} // namespace imu
+
+#endif // IMU_BMI08_HPP
@@ -0,0 +1,330 @@
+#include "imu_calib.h"
+#include "imu_error.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define IMU_CALIB_FILE_MAGIC 0x43554d49u // "IMUC"
+#define IMU_CALIB_FILE_VERSION 1u
+
+struct batch_stats {
+  float mean[3];
+  float std[3];
+};
+
+struct store_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t count;
+};
+
+static void batch_stats(const struct bmi08_sensor_data *s, size_t n,
+                        struct batch_stats *out) {
+  int64_t sum[3] = {0, 0, 0};
+  int64_t sq[3] = {0, 0, 0};
+
+  for (size_t i = 0; i < n; i++) {
+    sum[0] += s[i].x;
+    sum[1] += s[i].y;
+    sum[2] += s[i].z;
+    sq[0] += (int32_t)s[i].x * s[i].x;
+    sq[1] += (int32_t)s[i].y * s[i].y;
+    sq[2] += (int32_t)s[i].z * s[i].z;
+  }
+  for (int a = 0; a < 3; a++) {
+    double mean = (double)sum[a] / (double)n;
+    double var = (double)sq[a] / (double)n - mean * mean;
+    out->mean[a] = (float)mean;
+    out->std[a] = var > 0.0 ? (float)sqrt(var) : 0.0f;
+  }
+}
+
+static int is_still(const struct batch_stats *st, float limit) {
+  return st->std[0] < limit && st->std[1] < limit && st->std[2] < limit;
+}
+
+// Returns the face index (axis * 2, +1 when pointing down) whose axis is
+// carrying gravity, or -1 when no axis is close enough to 1 g.
+static int gravity_face(const struct batch_stats *st, float one_g) {
+  int axis = 0;
+  for (int a = 1; a < 3; a++) {
+    if (fabsf(st->mean[a]) > fabsf(st->mean[axis]))
+      axis = a;
+  }
+  if (fabsf(st->mean[axis]) < 0.8f * one_g)
+    return -1;
+  return axis * 2 + (st->mean[axis] < 0.0f);
+}
+
+void imu_calib_init(struct imu_calib_estimator *est,
+                    const struct imu_calib_config *cfg) {
+  memset(est, 0, sizeof(*est));
+  est->cfg = *cfg;
+}
+
+int imu_calib_feed(struct imu_calib_estimator *est,
+                   const struct bmi08_sensor_data *accel,
+                   const struct bmi08_sensor_data *gyro, size_t n) {
+  struct batch_stats st;
+  int accel_still = 1;
+
+  if (est == NULL)
+    return IMU_E_NULL_PTR;
+  if (n == 0)
+    return IMU_OK;
+
+  if (accel != NULL) {
+    batch_stats(accel, n, &st);
+    accel_still = is_still(&st, est->cfg.accel_still_lsb);
+    if (accel_still) {
+      int face = gravity_face(&st, est->cfg.one_g_lsb);
+      if (face >= 0) {
+        struct imu_calib_face *f = &est->faces[face];
+        for (int a = 0; a < 3; a++)
+          f->sum[a] += (double)st.mean[a] * (double)n;
+        f->count += (uint32_t)n;
+      }
+    }
+  }
+
+  if (gyro != NULL && accel_still) {
+    batch_stats(gyro, n, &st);
+    if (is_still(&st, est->cfg.gyro_still_lsb)) {
+      for (int a = 0; a < 3; a++)
+        est->gyro_sum[a] += (double)st.mean[a] * (double)n;
+      est->gyro_count += (uint32_t)n;
+    }
+  }
+
+  return IMU_OK;
+}
+
+unsigned imu_calib_progress(const struct imu_calib_estimator *est) {
+  unsigned done = IMU_CALIB_ACCEL_DONE;
+
+  for (int f = 0; f < 6; f++) {
+    if (est->faces[f].count < est->cfg.min_face_samples)
+      done = 0;
+  }
+  if (est->gyro_count >= est->cfg.min_gyro_samples && est->gyro_count > 0)
+    done |= IMU_CALIB_GYRO_DONE;
+  return done;
+}
+
+int imu_calib_solve(const struct imu_calib_estimator *est,
+                    struct imu_calib_profile *out) {
+  unsigned done;
+
+  if (est == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+
+  done = imu_calib_progress(est);
+  if (done == 0)
+    return IMU_E_NOT_READY;
+
+  if (done & IMU_CALIB_ACCEL_DONE) {
+    for (int a = 0; a < 3; a++) {
+      const struct imu_calib_face *up = &est->faces[a * 2];
+      const struct imu_calib_face *down = &est->faces[a * 2 + 1];
+      double pos = up->sum[a] / up->count;
+      double neg = down->sum[a] / down->count;
+      out->accel_bias[a] = (float)((pos + neg) * 0.5);
+      out->accel_scale[a] = (float)(2.0 * est->cfg.one_g_lsb / (pos - neg));
+    }
+  }
+  if (done & IMU_CALIB_GYRO_DONE) {
+    for (int a = 0; a < 3; a++)
+      out->gyro_bias[a] = (float)(est->gyro_sum[a] / est->gyro_count);
+  }
+  out->flags |= done;
+
+  return IMU_OK;
+}
+
+void imu_calib_kernel_accel(struct imu_calib_kernel *k,
+                            const struct imu_calib_profile *p,
+                            float unit_per_lsb) {
+  for (int a = 0; a < 3; a++) {
+    float bias = 0.0f, scale = 1.0f;
+    if (p != NULL && (p->flags & IMU_CALIB_ACCEL_DONE)) {
+      bias = p->accel_bias[a];
+      scale = p->accel_scale[a];
+    }
+    k->gain[a] = scale * unit_per_lsb;
+    k->offset[a] = -bias * scale * unit_per_lsb;
+  }
+}
+
+void imu_calib_kernel_gyro(struct imu_calib_kernel *k,
+                           const struct imu_calib_profile *p,
+                           float unit_per_lsb) {
+  for (int a = 0; a < 3; a++) {
+    float bias = 0.0f;
+    if (p != NULL && (p->flags & IMU_CALIB_GYRO_DONE))
+      bias = p->gyro_bias[a];
+    k->gain[a] = unit_per_lsb;
+    k->offset[a] = -bias * unit_per_lsb;
+  }
+}
+
+// One multiply-add per lane with no branches, so the loop vectorizes.
+void imu_calib_apply(const struct imu_calib_kernel *k,
+                     const struct bmi08_sensor_data *in, size_t n,
+                     float *restrict x, float *restrict y, float *restrict z) {
+  const float gx = k->gain[0], gy = k->gain[1], gz = k->gain[2];
+  const float ox = k->offset[0], oy = k->offset[1], oz = k->offset[2];
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = (float)in[i].x * gx + ox;
+    y[i] = (float)in[i].y * gy + oy;
+    z[i] = (float)in[i].z * gz + oz;
+  }
+}
+
+void imu_calib_apply_block(const struct imu_calib_kernel *k,
+                           const struct imu_block *in,
+                           struct imu_block_f *out) {
+  const float gx = k->gain[0], gy = k->gain[1], gz = k->gain[2];
+  const float ox = k->offset[0], oy = k->offset[1], oz = k->offset[2];
+  const size_t n = in->n;
+
+  for (size_t i = 0; i < n; i++) {
+    out->x[i] = (float)in->x[i] * gx + ox;
+    out->y[i] = (float)in->y[i] * gy + oy;
+    out->z[i] = (float)in->z[i] * gz + oz;
+  }
+  memcpy(out->t, in->t, n * sizeof(uint64_t));
+  out->n = n;
+}
+
+void imu_calib_store_init(struct imu_calib_store *store) {
+  memset(store, 0, sizeof(*store));
+}
+
+static struct imu_calib_profile *store_slot(struct imu_calib_store *store,
+                                            uint8_t accel_chip_id,
+                                            uint8_t gyro_chip_id,
+                                            uint32_t serial) {
+  for (size_t i = 0; i < store->count; i++) {
+    struct imu_calib_profile *p = &store->profiles[i];
+    if (p->accel_chip_id == accel_chip_id && p->gyro_chip_id == gyro_chip_id &&
+        p->serial == serial)
+      return p;
+  }
+  return NULL;
+}
+
+int imu_calib_store_put(struct imu_calib_store *store,
+                        const struct imu_calib_profile *p) {
+  struct imu_calib_profile *slot;
+
+  if (store == NULL || p == NULL)
+    return IMU_E_NULL_PTR;
+
+  slot = store_slot(store, p->accel_chip_id, p->gyro_chip_id, p->serial);
+  if (slot == NULL) {
+    if (store->count == IMU_CALIB_STORE_MAX)
+      return IMU_E_FULL;
+    slot = &store->profiles[store->count++];
+  }
+  // Field by field over a zeroed slot: a struct copy may carry the
+  // caller's padding bytes into the checksummed file image.
+  memset(slot, 0, sizeof(*slot));
+  slot->accel_chip_id = p->accel_chip_id;
+  slot->gyro_chip_id = p->gyro_chip_id;
+  slot->serial = p->serial;
+  slot->flags = p->flags;
+  memcpy(slot->accel_bias, p->accel_bias, sizeof(slot->accel_bias));
+  memcpy(slot->accel_scale, p->accel_scale, sizeof(slot->accel_scale));
+  memcpy(slot->gyro_bias, p->gyro_bias, sizeof(slot->gyro_bias));
+  return IMU_OK;
+}
+
+const struct imu_calib_profile *
+imu_calib_store_find(const struct imu_calib_store *store, uint8_t accel_chip_id,
+                     uint8_t gyro_chip_id, uint32_t serial) {
+  if (store == NULL)
+    return NULL;
+  return store_slot((struct imu_calib_store *)store, accel_chip_id,
+                    gyro_chip_id, serial);
+}
+
+static uint32_t fnv1a(const void *data, size_t len) {
+  const uint8_t *b = data;
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h ^= b[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+int imu_calib_store_save(const struct imu_calib_store *store,
+                         const char *path) {
+  struct store_header hdr;
+  size_t bytes;
+  uint32_t sum;
+  FILE *f;
+  int ok;
+
+  if (store == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  hdr.magic = IMU_CALIB_FILE_MAGIC;
+  hdr.version = IMU_CALIB_FILE_VERSION;
+  hdr.record_size = sizeof(struct imu_calib_profile);
+  hdr.count = (uint32_t)store->count;
+  bytes = store->count * sizeof(struct imu_calib_profile);
+  sum = fnv1a(store->profiles, bytes);
+
+  f = fopen(path, "wb");
+  if (f == NULL)
+    return IMU_E_IO;
+  ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+       (bytes == 0 || fwrite(store->profiles, bytes, 1, f) == 1) &&
+       fwrite(&sum, sizeof(sum), 1, f) == 1;
+  if (fclose(f) != 0)
+    ok = 0;
+
+  return ok ? IMU_OK : IMU_E_IO;
+}
+
+int imu_calib_store_load(struct imu_calib_store *store, const char *path) {
+  struct store_header hdr;
+  struct imu_calib_store tmp;
+  size_t bytes;
+  uint32_t sum;
+  int rslt = IMU_OK;
+  FILE *f;
+
+  if (store == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  f = fopen(path, "rb");
+  if (f == NULL)
+    return IMU_E_IO;
+
+  imu_calib_store_init(&tmp);
+  if (fread(&hdr, sizeof(hdr), 1, f) != 1) {
+    rslt = IMU_E_IO;
+  } else if (hdr.magic != IMU_CALIB_FILE_MAGIC ||
+             hdr.version != IMU_CALIB_FILE_VERSION ||
+             hdr.record_size != sizeof(struct imu_calib_profile) ||
+             hdr.count > IMU_CALIB_STORE_MAX) {
+    rslt = IMU_E_FORMAT;
+  } else {
+    tmp.count = hdr.count;
+    bytes = tmp.count * sizeof(struct imu_calib_profile);
+    if ((bytes != 0 && fread(tmp.profiles, bytes, 1, f) != 1) ||
+        fread(&sum, sizeof(sum), 1, f) != 1)
+      rslt = IMU_E_IO;
+    else if (sum != fnv1a(tmp.profiles, bytes))
+      rslt = IMU_E_FORMAT;
+  }
+  fclose(f);
+
+  if (rslt == IMU_OK)
+    *store = tmp;
+  return rslt;
+}
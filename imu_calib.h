@@ -0,0 +1,102 @@
+#ifndef IMU_CALIB_H
+#define IMU_CALIB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_block.h"
+
+#define IMU_CALIB_STORE_MAX 16
+
+// Bits reported by imu_calib_progress().
+#define IMU_CALIB_ACCEL_DONE 0x01u
+#define IMU_CALIB_GYRO_DONE 0x02u
+
+// Correction for one sensor pair. Biases are in raw LSB, scales are the
+// dimensionless factors that map (raw - bias) back onto the nominal range.
+struct imu_calib_profile {
+  uint8_t accel_chip_id;
+  uint8_t gyro_chip_id;
+  uint32_t serial;
+  uint32_t flags;
+  float accel_bias[3];
+  float accel_scale[3];
+  float gyro_bias[3];
+};
+
+struct imu_calib_config {
+  // Nominal 1 g in accel LSB for the configured range and variant.
+  float one_g_lsb;
+  // Per-axis standard deviation below which a batch counts as stationary.
+  float accel_still_lsb;
+  float gyro_still_lsb;
+  // Samples to average per accel face and for the gyro bias.
+  uint32_t min_face_samples;
+  uint32_t min_gyro_samples;
+};
+
+struct imu_calib_face {
+  double sum[3];
+  uint32_t count;
+};
+
+// Streaming estimator: six-position accel bias/scale and stationary gyro
+// bias. Feed it batches as they come off the FIFO, then call solve.
+struct imu_calib_estimator {
+  struct imu_calib_config cfg;
+  struct imu_calib_face faces[6];
+  double gyro_sum[3];
+  uint32_t gyro_count;
+};
+
+// Precomputed out = raw * gain + offset per axis, built from a profile.
+struct imu_calib_kernel {
+  float gain[3];
+  float offset[3];
+};
+
+struct imu_calib_store {
+  size_t count;
+  struct imu_calib_profile profiles[IMU_CALIB_STORE_MAX];
+};
+
+void imu_calib_init(struct imu_calib_estimator *est,
+                    const struct imu_calib_config *cfg);
+
+// Either accel or gyro may be NULL. When both are given they must hold the
+// same number of samples and gyro is only used if accel is also stationary.
+int imu_calib_feed(struct imu_calib_estimator *est,
+                   const struct bmi08_sensor_data *accel,
+                   const struct bmi08_sensor_data *gyro, size_t n);
+
+unsigned imu_calib_progress(const struct imu_calib_estimator *est);
+
+// Fills the estimated fields of out; chip ids and serial are left alone.
+int imu_calib_solve(const struct imu_calib_estimator *est,
+                    struct imu_calib_profile *out);
+
+void imu_calib_kernel_accel(struct imu_calib_kernel *k,
+                            const struct imu_calib_profile *p,
+                            float unit_per_lsb);
+void imu_calib_kernel_gyro(struct imu_calib_kernel *k,
+                           const struct imu_calib_profile *p,
+                           float unit_per_lsb);
+
+// Decodes AoS samples into calibrated SoA floats in a single pass.
+void imu_calib_apply(const struct imu_calib_kernel *k,
+                     const struct bmi08_sensor_data *in, size_t n, float *x,
+                     float *y, float *z);
+void imu_calib_apply_block(const struct imu_calib_kernel *k,
+                           const struct imu_block *in, struct imu_block_f *out);
+
+void imu_calib_store_init(struct imu_calib_store *store);
+int imu_calib_store_put(struct imu_calib_store *store,
+                        const struct imu_calib_profile *p);
+const struct imu_calib_profile *
+imu_calib_store_find(const struct imu_calib_store *store, uint8_t accel_chip_id,
+                     uint8_t gyro_chip_id, uint32_t serial);
+int imu_calib_store_save(const struct imu_calib_store *store, const char *path);
+int imu_calib_store_load(struct imu_calib_store *store, const char *path);
+
+#endif // IMU_CALIB_H
@@ -0,0 +1,458 @@
+#include "imu_capture.h"
+#include "imu_error.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct record_header {
+  uint8_t kind;
+  uint8_t encoding;
+  uint16_t device;
+  uint32_t len;
+};
+
+static size_t raw_encode(const struct imu_block *b, uint8_t *out) {
+  uint16_t n = (uint16_t)b->n;
+  uint8_t *p = out;
+
+  memcpy(p, &n, 2);
+  p += 2;
+  memcpy(p, b->x, n * sizeof(int16_t));
+  p += n * sizeof(int16_t);
+  memcpy(p, b->y, n * sizeof(int16_t));
+  p += n * sizeof(int16_t);
+  memcpy(p, b->z, n * sizeof(int16_t));
+  p += n * sizeof(int16_t);
+  memcpy(p, b->t, n * sizeof(uint64_t));
+  p += n * sizeof(uint64_t);
+  return (size_t)(p - out);
+}
+
+static int raw_decode(const uint8_t *in, size_t len, struct imu_block *b) {
+  uint16_t n;
+
+  if (len < 2)
+    return IMU_E_FORMAT;
+  memcpy(&n, in, 2);
+  if (n > IMU_BLOCK_CAP || len != 2 + (size_t)n * (3 * 2 + 8))
+    return IMU_E_FORMAT;
+  in += 2;
+  memcpy(b->x, in, n * sizeof(int16_t));
+  in += n * sizeof(int16_t);
+  memcpy(b->y, in, n * sizeof(int16_t));
+  in += n * sizeof(int16_t);
+  memcpy(b->z, in, n * sizeof(int16_t));
+  in += n * sizeof(int16_t);
+  memcpy(b->t, in, n * sizeof(uint64_t));
+  b->n = n;
+  return IMU_OK;
+}
+
+int imu_capture_start(struct imu_capture_writer *w, FILE *out,
+                      enum imu_capture_encoding encoding) {
+  uint8_t hdr[IMU_CAPTURE_HEADER];
+  uint32_t magic = IMU_CAPTURE_MAGIC;
+  uint16_t version = IMU_CAPTURE_VERSION, enc = (uint16_t)encoding;
+
+  if (w == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  if (encoding != IMU_CAPTURE_RAW && encoding != IMU_CAPTURE_PACKED)
+    return IMU_E_INVALID_INPUT;
+
+  memcpy(hdr, &magic, 4);
+  memcpy(hdr + 4, &version, 2);
+  memcpy(hdr + 6, &enc, 2);
+  if (fwrite(hdr, 1, sizeof(hdr), out) != sizeof(hdr))
+    return IMU_E_IO;
+
+  w->out = out;
+  w->encoding = encoding;
+  w->chunk_records = IMU_CAPTURE_CHUNK_RECORDS;
+  w->chunks = 0;
+  w->last_index = 0;
+  memset(&w->cur, 0, sizeof(w->cur));
+  w->pending = 0;
+  w->records = 0;
+  w->samples = 0;
+  w->bytes = sizeof(hdr);
+  w->failed = 0;
+  return IMU_OK;
+}
+
+// Writes the record staged in w->buf.
+static int emit(struct imu_capture_writer *w, enum imu_capture_kind kind,
+                uint8_t encoding, uint16_t device, size_t len) {
+  struct record_header h;
+  size_t total = IMU_CAPTURE_RECORD_HEADER + len;
+
+  h.kind = (uint8_t)kind;
+  h.encoding = encoding;
+  h.device = device;
+  h.len = (uint32_t)len;
+  memcpy(w->buf, &h, sizeof(h));
+  if (fwrite(w->buf, 1, total, w->out) != total) {
+    w->failed = 1;
+    return IMU_E_IO;
+  }
+  w->bytes += total;
+  return IMU_OK;
+}
+
+// INDEX payload: u64 offset of the previous INDEX record, u32 count, u32
+// zero, then the entries.
+static int write_index(struct imu_capture_writer *w) {
+  uint8_t *p = w->buf + IMU_CAPTURE_RECORD_HEADER;
+  uint32_t count = w->pending, zero = 0;
+  uint64_t at = w->bytes;
+  int rslt;
+
+  memcpy(p, &w->last_index, 8);
+  memcpy(p + 8, &count, 4);
+  memcpy(p + 12, &zero, 4);
+  memcpy(p + 16, w->batch, count * sizeof(w->batch[0]));
+  rslt = emit(w, IMU_CAPTURE_INDEX, IMU_CAPTURE_RAW, 0,
+              16 + count * sizeof(w->batch[0]));
+  if (rslt != IMU_OK)
+    return rslt;
+  w->last_index = at;
+  w->pending = 0;
+  return IMU_OK;
+}
+
+static int close_chunk(struct imu_capture_writer *w) {
+  uint64_t t_last = w->cur.t_last;
+
+  if (w->cur.records == 0)
+    return IMU_OK;
+  w->cur.bytes = (uint32_t)(w->bytes - w->cur.offset);
+  if (w->cur.samples == 0)
+    w->cur.t_first = t_last;
+  w->batch[w->pending++] = w->cur;
+  w->chunks++;
+  memset(&w->cur, 0, sizeof(w->cur));
+  w->cur.t_last = t_last;
+  if (w->pending == IMU_CAPTURE_INDEX_BATCH)
+    return write_index(w);
+  return IMU_OK;
+}
+
+int imu_capture_write(struct imu_capture_writer *w, uint16_t device,
+                      enum imu_capture_kind kind, const struct imu_block *b) {
+  uint8_t *payload;
+  uint64_t at;
+  int len, rslt;
+
+  if (w == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+  if (b->n > IMU_BLOCK_CAP || kind == IMU_CAPTURE_INDEX)
+    return IMU_E_INVALID_INPUT;
+
+  payload = w->buf + IMU_CAPTURE_RECORD_HEADER;
+  if (w->encoding == IMU_CAPTURE_PACKED) {
+    len = imu_codec_encode(b, payload, IMU_CAPTURE_PAYLOAD_MAX);
+    if (len < 0)
+      return len;
+  } else {
+    len = (int)raw_encode(b, payload);
+  }
+
+  at = w->bytes;
+  rslt = emit(w, kind, (uint8_t)w->encoding, device, (size_t)len);
+  if (rslt != IMU_OK)
+    return rslt;
+  w->records++;
+  w->samples += b->n;
+
+  if (w->cur.records == 0)
+    w->cur.offset = at;
+  if (b->n > 0) {
+    if (w->cur.samples == 0 || b->t[0] < w->cur.t_first)
+      w->cur.t_first = b->t[0];
+    if (b->t[b->n - 1] > w->cur.t_last)
+      w->cur.t_last = b->t[b->n - 1];
+  }
+  w->cur.samples += (uint32_t)b->n;
+  w->cur.records++;
+  if (w->cur.records >= w->chunk_records)
+    return close_chunk(w);
+  return IMU_OK;
+}
+
+int imu_capture_finish(struct imu_capture_writer *w) {
+  uint8_t footer[IMU_CAPTURE_FOOTER];
+  uint32_t magic = IMU_CAPTURE_FOOTER_MAGIC;
+  int rslt;
+
+  if (w == NULL || w->out == NULL)
+    return IMU_E_NULL_PTR;
+
+  rslt = close_chunk(w);
+  if (rslt == IMU_OK && w->pending > 0)
+    rslt = write_index(w);
+  if (rslt == IMU_OK) {
+    memcpy(footer, &w->last_index, 8);
+    memcpy(footer + 8, &w->chunks, 4);
+    memcpy(footer + 12, &magic, 4);
+    if (fwrite(footer, 1, sizeof(footer), w->out) != sizeof(footer))
+      w->failed = 1;
+    else
+      w->bytes += sizeof(footer);
+  }
+  if (fflush(w->out) != 0)
+    w->failed = 1;
+  return w->failed ? IMU_E_IO : IMU_OK;
+}
+
+// Trusts a footer only when it points at an INDEX record that ends right
+// where the footer begins, or, for a capture without chunks, when it
+// points nowhere.
+static void read_footer(struct imu_capture_reader *r) {
+  const uint8_t *f;
+  struct record_header h;
+  uint64_t at;
+  uint32_t magic, chunks;
+  size_t end;
+
+  if (r->len < IMU_CAPTURE_HEADER + IMU_CAPTURE_FOOTER)
+    return;
+  end = r->len - IMU_CAPTURE_FOOTER;
+  f = r->data + end;
+  memcpy(&at, f, 8);
+  memcpy(&chunks, f + 8, 4);
+  memcpy(&magic, f + 12, 4);
+  if (magic != IMU_CAPTURE_FOOTER_MAGIC)
+    return;
+  if (at == 0) {
+    if (chunks != 0)
+      return;
+  } else {
+    if (at < IMU_CAPTURE_HEADER || end < IMU_CAPTURE_RECORD_HEADER ||
+        at > end - IMU_CAPTURE_RECORD_HEADER)
+      return;
+    memcpy(&h, r->data + at, sizeof(h));
+    if (h.kind != IMU_CAPTURE_INDEX ||
+        at + IMU_CAPTURE_RECORD_HEADER + h.len != end)
+      return;
+  }
+
+  r->len = end;
+  r->last_index = at;
+  r->chunks = chunks;
+}
+
+int imu_capture_reader_init(struct imu_capture_reader *r, const uint8_t *data,
+                            size_t len) {
+  uint32_t magic;
+  uint16_t version;
+
+  if (r == NULL || data == NULL)
+    return IMU_E_NULL_PTR;
+  if (len < IMU_CAPTURE_HEADER)
+    return IMU_E_FORMAT;
+  memcpy(&magic, data, 4);
+  memcpy(&version, data + 4, 2);
+  if (magic != IMU_CAPTURE_MAGIC || version < 1 ||
+      version > IMU_CAPTURE_VERSION)
+    return IMU_E_FORMAT;
+
+  r->data = data;
+  r->len = len;
+  r->pos = IMU_CAPTURE_HEADER;
+  r->map_len = 0;
+  r->last_index = 0;
+  r->chunks = 0;
+  read_footer(r);
+  return IMU_OK;
+}
+
+int imu_capture_open(struct imu_capture_reader *r, const char *path) {
+  struct stat st;
+  void *p;
+  int fd, rslt;
+
+  if (r == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return IMU_E_IO;
+  if (fstat(fd, &st) != 0 || st.st_size < IMU_CAPTURE_HEADER) {
+    close(fd);
+    return IMU_E_FORMAT;
+  }
+  p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return IMU_E_IO;
+
+  rslt = imu_capture_reader_init(r, p, (size_t)st.st_size);
+  if (rslt != IMU_OK) {
+    munmap(p, (size_t)st.st_size);
+    return rslt;
+  }
+  r->map_len = (size_t)st.st_size;
+  return IMU_OK;
+}
+
+void imu_capture_close(struct imu_capture_reader *r) {
+  if (r->map_len != 0)
+    munmap((void *)r->data, r->map_len);
+  r->last_index = 0;
+  r->chunks = 0;
+  r->data = NULL;
+  r->len = 0;
+  r->map_len = 0;
+}
+
+int imu_capture_next(struct imu_capture_reader *r, uint16_t *device,
+                     enum imu_capture_kind *kind, struct imu_block *b) {
+  struct record_header h;
+  const uint8_t *payload;
+  int rslt;
+
+  if (r == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+  for (;;) {
+    if (r->pos >= r->len)
+      return IMU_E_NOT_FOUND;
+    if (r->len - r->pos < IMU_CAPTURE_RECORD_HEADER)
+      return IMU_E_FORMAT;
+    memcpy(&h, r->data + r->pos, sizeof(h));
+    if (h.len > r->len - r->pos - IMU_CAPTURE_RECORD_HEADER)
+      return IMU_E_FORMAT;
+    if (h.kind != IMU_CAPTURE_INDEX)
+      break;
+    r->pos += IMU_CAPTURE_RECORD_HEADER + h.len;
+  }
+  payload = r->data + r->pos + IMU_CAPTURE_RECORD_HEADER;
+
+  if (h.encoding == IMU_CAPTURE_PACKED) {
+    rslt = imu_codec_decode(payload, h.len, b);
+    rslt = rslt == (int)h.len ? IMU_OK : IMU_E_FORMAT;
+  } else if (h.encoding == IMU_CAPTURE_RAW) {
+    rslt = raw_decode(payload, h.len, b);
+  } else {
+    rslt = IMU_E_FORMAT;
+  }
+  if (rslt != IMU_OK)
+    return rslt;
+
+  r->pos += IMU_CAPTURE_RECORD_HEADER + h.len;
+  if (device != NULL)
+    *device = h.device;
+  if (kind != NULL)
+    *kind = (enum imu_capture_kind)h.kind;
+  return IMU_OK;
+}
+
+// Header of the INDEX record at pos; its entries follow at pos + 24.
+static int index_at(const struct imu_capture_reader *r, uint64_t pos,
+                    uint64_t *prev, uint32_t *count) {
+  struct record_header h;
+
+  if (pos < IMU_CAPTURE_HEADER || pos > r->len - IMU_CAPTURE_RECORD_HEADER)
+    return IMU_E_FORMAT;
+  memcpy(&h, r->data + pos, sizeof(h));
+  if (h.kind != IMU_CAPTURE_INDEX || h.len < 16 ||
+      h.len > r->len - pos - IMU_CAPTURE_RECORD_HEADER)
+    return IMU_E_FORMAT;
+  memcpy(prev, r->data + pos + IMU_CAPTURE_RECORD_HEADER, 8);
+  memcpy(count, r->data + pos + IMU_CAPTURE_RECORD_HEADER + 8, 4);
+  if (h.len != 16 + (uint64_t)*count * sizeof(struct imu_capture_chunk))
+    return IMU_E_FORMAT;
+  return IMU_OK;
+}
+
+// No footer: collect INDEX records front to back, stopping at a torn tail.
+static int scan_index(const struct imu_capture_reader *r,
+                      struct imu_capture_chunk *out, size_t cap,
+                      size_t *count) {
+  size_t pos = IMU_CAPTURE_HEADER, n = 0;
+  struct record_header h;
+  uint64_t prev;
+  uint32_t k;
+
+  while (r->len - pos >= IMU_CAPTURE_RECORD_HEADER) {
+    memcpy(&h, r->data + pos, sizeof(h));
+    if (h.len > r->len - pos - IMU_CAPTURE_RECORD_HEADER)
+      break;
+    if (h.kind == IMU_CAPTURE_INDEX) {
+      if (index_at(r, pos, &prev, &k) != IMU_OK)
+        return IMU_E_FORMAT;
+      if (out != NULL) {
+        if (n + k > cap)
+          return IMU_E_FULL;
+        memcpy(out + n, r->data + pos + IMU_CAPTURE_RECORD_HEADER + 16,
+               k * sizeof(*out));
+      }
+      n += k;
+    }
+    pos += IMU_CAPTURE_RECORD_HEADER + h.len;
+  }
+  *count = n;
+  return n > 0 ? IMU_OK : IMU_E_NOT_FOUND;
+}
+
+int imu_capture_index(const struct imu_capture_reader *r,
+                      struct imu_capture_chunk *out, size_t cap,
+                      size_t *count) {
+  uint64_t pos, prev;
+  size_t fill;
+  uint32_t k;
+
+  if (r == NULL || r->data == NULL || count == NULL)
+    return IMU_E_NULL_PTR;
+  if (r->last_index == 0)
+    return scan_index(r, out, cap, count);
+
+  *count = r->chunks;
+  if (out == NULL)
+    return IMU_OK;
+  if (cap < r->chunks)
+    return IMU_E_FULL;
+
+  // The chain runs newest first, so fill from the back.
+  fill = r->chunks;
+  for (pos = r->last_index; pos != 0; pos = prev) {
+    if (index_at(r, pos, &prev, &k) != IMU_OK || k > fill || prev >= pos)
+      return IMU_E_FORMAT;
+    fill -= k;
+    memcpy(out + fill, r->data + pos + IMU_CAPTURE_RECORD_HEADER + 16,
+           k * sizeof(*out));
+  }
+  return fill == 0 ? IMU_OK : IMU_E_FORMAT;
+}
+
+size_t imu_capture_seek(const struct imu_capture_chunk *idx, size_t count,
+                        uint64_t t_ns) {
+  size_t lo = 0, hi = count;
+
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (idx[mid].t_last < t_ns)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+int imu_capture_chunk_reader(const struct imu_capture_reader *r,
+                             const struct imu_capture_chunk *c,
+                             struct imu_capture_reader *sub) {
+  if (r == NULL || c == NULL || sub == NULL || r->data == NULL)
+    return IMU_E_NULL_PTR;
+  if (c->offset < IMU_CAPTURE_HEADER || c->offset > r->len ||
+      c->bytes > r->len - c->offset)
+    return IMU_E_FORMAT;
+
+  sub->data = r->data;
+  sub->len = (size_t)(c->offset + c->bytes);
+  sub->pos = (size_t)c->offset;
+  sub->map_len = 0;
+  sub->last_index = 0;
+  sub->chunks = 0;
+  return IMU_OK;
+}
@@ -0,0 +1,114 @@
+#ifndef IMU_CAPTURE_H
+#define IMU_CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "imu_block.h"
+#include "imu_codec.h"
+
+// Capture file of drained sample blocks. "IMUC", u16 version, u16
+// encoding, then one record per block: u8 kind, u8 encoding, u16 device,
+// u32 payload length and the payload. A RAW payload is u16 n followed by
+// the x, y, z and t lanes as stored in imu_block; a PACKED one is an
+// imu_codec block.
+//
+// Version 2 groups the records into chunks of chunk_records blocks that
+// each decode on their own. Every IMU_CAPTURE_INDEX_BATCH chunks the
+// writer emits an INDEX record with their entries and the offset of the
+// previous INDEX record, and finish appends a footer pointing at the last
+// one. Loading the index walks that chain back from the footer; a capture
+// cut short without a footer is scanned for INDEX records instead and
+// loses only the chunks after the last one.
+
+#define IMU_CAPTURE_MAGIC 0x43554d49u // "IMUC"
+#define IMU_CAPTURE_VERSION 2u
+#define IMU_CAPTURE_FOOTER_MAGIC 0x58554d49u // "IMUX"
+
+enum imu_capture_kind {
+  IMU_CAPTURE_ACCEL,
+  IMU_CAPTURE_GYRO,
+  IMU_CAPTURE_INDEX
+};
+enum imu_capture_encoding { IMU_CAPTURE_RAW, IMU_CAPTURE_PACKED };
+
+#define IMU_CAPTURE_HEADER 8
+#define IMU_CAPTURE_RECORD_HEADER 8
+#define IMU_CAPTURE_FOOTER 16 // u64 last INDEX offset, u32 chunks, magic
+#define IMU_CAPTURE_CHUNK_RECORDS 64
+#define IMU_CAPTURE_INDEX_BATCH 64
+#define IMU_CAPTURE_RAW_MAX (2 + IMU_BLOCK_CAP * (3 * 2 + 8))
+#define IMU_CAPTURE_PAYLOAD_MAX                                                \
+  (IMU_CODEC_MAX_BYTES > IMU_CAPTURE_RAW_MAX ? IMU_CODEC_MAX_BYTES             \
+                                             : IMU_CAPTURE_RAW_MAX)
+
+// One index entry. t_last never decreases from one chunk to the next
+// (it is the latest time seen so far), so the index is sorted by it.
+struct imu_capture_chunk {
+  uint64_t offset; // of the first record, from the start of the file
+  uint64_t t_first;
+  uint64_t t_last;
+  uint32_t bytes;
+  uint32_t samples;
+  uint32_t records;
+  uint32_t reserved;
+};
+
+struct imu_capture_writer {
+  FILE *out;
+  enum imu_capture_encoding encoding;
+  uint32_t chunk_records; // may be changed before the first write
+  uint32_t chunks;
+  uint64_t last_index; // offset of the last INDEX record, 0 for none
+  struct imu_capture_chunk cur;
+  unsigned pending;
+  struct imu_capture_chunk batch[IMU_CAPTURE_INDEX_BATCH];
+  uint64_t records;
+  uint64_t samples;
+  uint64_t bytes; // written, headers included
+  int failed;
+  uint8_t buf[IMU_CAPTURE_RECORD_HEADER + IMU_CAPTURE_PAYLOAD_MAX];
+};
+
+struct imu_capture_reader {
+  const uint8_t *data;
+  size_t len;
+  size_t pos;
+  size_t map_len; // nonzero when data was mapped by imu_capture_open
+  uint64_t last_index; // from the footer, 0 without one
+  uint32_t chunks;
+};
+
+int imu_capture_start(struct imu_capture_writer *w, FILE *out,
+                      enum imu_capture_encoding encoding);
+int imu_capture_write(struct imu_capture_writer *w, uint16_t device,
+                      enum imu_capture_kind kind, const struct imu_block *b);
+// Closes the last chunk, writes the index tail and footer and flushes;
+// IMU_E_IO when any write failed.
+int imu_capture_finish(struct imu_capture_writer *w);
+
+int imu_capture_reader_init(struct imu_capture_reader *r, const uint8_t *data,
+                            size_t len);
+int imu_capture_open(struct imu_capture_reader *r, const char *path);
+void imu_capture_close(struct imu_capture_reader *r);
+// Returns IMU_OK, IMU_E_NOT_FOUND at the end or IMU_E_FORMAT.
+int imu_capture_next(struct imu_capture_reader *r, uint16_t *device,
+                     enum imu_capture_kind *kind, struct imu_block *b);
+
+// Copies the index into out, oldest chunk first, and stores the number of
+// chunks in *count. With out NULL only counts. IMU_E_FULL when cap is too
+// small, IMU_E_NOT_FOUND for a capture without any index.
+int imu_capture_index(const struct imu_capture_reader *r,
+                      struct imu_capture_chunk *out, size_t cap,
+                      size_t *count);
+// First chunk that can hold samples at or after t_ns, count if none.
+size_t imu_capture_seek(const struct imu_capture_chunk *idx, size_t count,
+                        uint64_t t_ns);
+// Reader over one chunk of r. It shares r's data, so any number of them
+// can decode different chunks on different threads while r stays open.
+int imu_capture_chunk_reader(const struct imu_capture_reader *r,
+                             const struct imu_capture_chunk *c,
+                             struct imu_capture_reader *sub);
+
+#endif // IMU_CAPTURE_H
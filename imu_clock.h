@@ -0,0 +1,32 @@
+#ifndef IMU_CLOCK_H
+#define IMU_CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Monotonic wall time in nanoseconds.
+static inline uint64_t imu_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Cheapest available cycle-ish counter for profiling hot loops. Falls back
+// to nanoseconds on targets without a user-readable counter.
+static inline uint64_t imu_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t v;
+  __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+  return v;
+#else
+  return imu_now_ns();
+#endif
+}
+
+#endif // IMU_CLOCK_H
@@ -0,0 +1,203 @@
+#include "imu_codec.h"
+#include "imu_error.h"
+#include <string.h>
+
+struct cursor {
+  uint8_t *p; // NULL once out of room or input
+  const uint8_t *end;
+};
+
+static void put(struct cursor *c, const void *v, size_t n) {
+  if (c->p == NULL || (size_t)(c->end - c->p) < n) {
+    c->p = NULL;
+    return;
+  }
+  memcpy(c->p, v, n);
+  c->p += n;
+}
+
+static void get(struct cursor *c, void *v, size_t n) {
+  if (c->p == NULL || (size_t)(c->end - c->p) < n) {
+    c->p = NULL;
+    return;
+  }
+  memcpy(v, c->p, n);
+  c->p += n;
+}
+
+static unsigned width_of(uint64_t v) {
+  unsigned w = 0;
+
+  while (v != 0) {
+    w++;
+    v >>= 1;
+  }
+  return w;
+}
+
+// One group of up to 32 values, zero padded, as width bit planes.
+static void pack32(struct cursor *c, const uint32_t *v) {
+  uint32_t any = 0;
+  uint8_t w;
+
+#pragma omp simd reduction(| : any)
+  for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+    any |= v[i];
+  w = (uint8_t)width_of(any);
+  put(c, &w, 1);
+  for (unsigned b = 0; b < w; b++) {
+    uint32_t plane = 0;
+#pragma omp simd reduction(| : plane)
+    for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+      plane |= ((v[i] >> b) & 1u) << i;
+    put(c, &plane, 4);
+  }
+}
+
+static void unpack32(struct cursor *c, uint32_t *v) {
+  uint8_t w = 0;
+
+  get(c, &w, 1);
+  if (w > 32)
+    c->p = NULL;
+  memset(v, 0, IMU_CODEC_GROUP * sizeof(*v));
+  for (unsigned b = 0; b < w && c->p != NULL; b++) {
+    uint32_t plane = 0;
+    get(c, &plane, 4);
+#pragma omp simd
+    for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+      v[i] |= ((plane >> i) & 1u) << b;
+  }
+}
+
+// Time deviations can exceed 32 bits across a long gap.
+static void pack64(struct cursor *c, const uint64_t *v) {
+  uint64_t any = 0;
+  uint8_t w;
+
+  for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+    any |= v[i];
+  w = (uint8_t)width_of(any);
+  put(c, &w, 1);
+  for (unsigned b = 0; b < w; b++) {
+    uint32_t plane = 0;
+    for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+      plane |= (uint32_t)((v[i] >> b) & 1u) << i;
+    put(c, &plane, 4);
+  }
+}
+
+static void unpack64(struct cursor *c, uint64_t *v) {
+  uint8_t w = 0;
+
+  get(c, &w, 1);
+  if (w > 64)
+    c->p = NULL;
+  memset(v, 0, IMU_CODEC_GROUP * sizeof(*v));
+  for (unsigned b = 0; b < w && c->p != NULL; b++) {
+    uint32_t plane = 0;
+    get(c, &plane, 4);
+    for (unsigned i = 0; i < IMU_CODEC_GROUP; i++)
+      v[i] |= (uint64_t)((plane >> i) & 1u) << b;
+  }
+}
+
+static void encode_lane(struct cursor *c, const int16_t *x, size_t n) {
+  uint32_t z[IMU_CODEC_GROUP];
+
+  put(c, &x[0], 2);
+  for (size_t g = 1; g < n; g += IMU_CODEC_GROUP) {
+    size_t k = n - g < IMU_CODEC_GROUP ? n - g : IMU_CODEC_GROUP;
+#pragma omp simd
+    for (size_t i = 0; i < IMU_CODEC_GROUP; i++) {
+      int32_t d = i < k ? (int32_t)x[g + i] - x[g + i - 1] : 0;
+      z[i] = (uint32_t)(d * 2) ^ (uint32_t)(d >> 31);
+    }
+    pack32(c, z);
+  }
+}
+
+static void decode_lane(struct cursor *c, int16_t *x, size_t n) {
+  uint32_t z[IMU_CODEC_GROUP];
+
+  get(c, &x[0], 2);
+  for (size_t g = 1; g < n && c->p != NULL; g += IMU_CODEC_GROUP) {
+    size_t k = n - g < IMU_CODEC_GROUP ? n - g : IMU_CODEC_GROUP;
+    unpack32(c, z);
+    // Prefix sum; the deltas are decoded with the planes above.
+    for (size_t i = 0; i < k; i++) {
+      int32_t d = (int32_t)(z[i] >> 1) ^ -(int32_t)(z[i] & 1u);
+      x[g + i] = (int16_t)(x[g + i - 1] + d);
+    }
+  }
+}
+
+int imu_codec_encode(const struct imu_block *b, uint8_t *out, size_t cap) {
+  struct cursor c = {out, out + cap};
+  uint64_t z[IMU_CODEC_GROUP];
+  uint16_t n;
+  uint32_t period;
+
+  if (b == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  if (b->n > IMU_BLOCK_CAP)
+    return IMU_E_INVALID_INPUT;
+
+  n = (uint16_t)b->n;
+  put(&c, &n, 2);
+  if (n > 0) {
+    period = n > 1 ? (uint32_t)(b->t[1] - b->t[0]) : 0;
+    put(&c, &b->t[0], 8);
+    put(&c, &period, 4);
+    for (size_t g = 1; g < n; g += IMU_CODEC_GROUP) {
+      for (size_t i = 0; i < IMU_CODEC_GROUP; i++) {
+        int64_t d = g + i < n ? (int64_t)(b->t[g + i] - b->t[g + i - 1]) -
+                                    (int64_t)period
+                              : 0;
+        z[i] = (uint64_t)d * 2 ^ (uint64_t)(d >> 63);
+      }
+      pack64(&c, z);
+    }
+    encode_lane(&c, b->x, n);
+    encode_lane(&c, b->y, n);
+    encode_lane(&c, b->z, n);
+  }
+  if (c.p == NULL)
+    return IMU_E_FULL;
+  return (int)(c.p - out);
+}
+
+int imu_codec_decode(const uint8_t *in, size_t len, struct imu_block *b) {
+  struct cursor c = {(uint8_t *)in, in + len};
+  uint64_t z[IMU_CODEC_GROUP];
+  uint16_t n = 0;
+  uint32_t period = 0;
+
+  if (in == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+
+  get(&c, &n, 2);
+  if (c.p == NULL || n > IMU_BLOCK_CAP)
+    return IMU_E_FORMAT;
+  b->n = n;
+  if (n > 0) {
+    get(&c, &b->t[0], 8);
+    get(&c, &period, 4);
+    for (size_t g = 1; g < n && c.p != NULL; g += IMU_CODEC_GROUP) {
+      size_t k = n - g < IMU_CODEC_GROUP ? n - g : IMU_CODEC_GROUP;
+      unpack64(&c, z);
+      for (size_t i = 0; i < k; i++) {
+        int64_t d = (int64_t)(z[i] >> 1) ^ -(int64_t)(z[i] & 1u);
+        b->t[g + i] = b->t[g + i - 1] + period + (uint64_t)d;
+      }
+    }
+    decode_lane(&c, b->x, n);
+    decode_lane(&c, b->y, n);
+    decode_lane(&c, b->z, n);
+  }
+  if (c.p == NULL) {
+    b->n = 0;
+    return IMU_E_FORMAT;
+  }
+  return (int)(c.p - in);
+}
@@ -0,0 +1,38 @@
+#ifndef IMU_CODEC_H
+#define IMU_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Lossless block codec. Each axis is stored as its first sample followed
+// by zigzag-coded deltas; timestamps as the first one, a nominal period and
+// zigzag-coded deviations from it, which are all zero on a gap-free clock.
+// Values go out in groups of 32 with one width byte per group and then
+// width bit planes of 32 bits each: plane b holds bit b of all 32 values.
+// Building or spreading a plane is the same operation on every lane, so
+// both directions vectorise, and a quiet sensor needs 4 to 6 bits a
+// sample instead of 16.
+//
+// Block: u16 n, then when n > 0: u64 t0, u32 period, groups of n - 1
+// time deviations, and per axis i16 first sample and groups of n - 1
+// deltas.
+
+#define IMU_CODEC_GROUP 32
+// Worst case, counted as four groups of 32-bit planes per 32 samples plus
+// width bytes. Time groups can be up to 64 planes wide, but sample deltas
+// zigzag to at most 17 bits, so the three sample groups always leave more
+// than a time group's extra 32 planes unused and the total still holds.
+#define IMU_CODEC_MAX_BYTES                                                    \
+  (2 + 8 + 4 + 3 * 2 +                                                         \
+   4 * ((IMU_BLOCK_CAP + IMU_CODEC_GROUP - 1) / IMU_CODEC_GROUP) *             \
+       (1 + IMU_CODEC_GROUP * 4))
+
+// Returns the encoded size, or a negative IMU_E_* code when out is too
+// small (IMU_E_FULL).
+int imu_codec_encode(const struct imu_block *b, uint8_t *out, size_t cap);
+// Returns the bytes consumed, or IMU_E_FORMAT for a damaged block.
+int imu_codec_decode(const uint8_t *in, size_t len, struct imu_block *b);
+
+#endif // IMU_CODEC_H
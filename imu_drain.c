@@ -0,0 +1,169 @@
+#include "imu_drain.h"
+#include "bmi08.h"
+#include "imu_error.h"
+#include <string.h>
+
+static inline int16_t le16(const uint8_t *p) {
+  return (int16_t)((uint16_t)p[1] << 8 | p[0]);
+}
+
+// Bytes in a header-mode accel frame including the header, or 0 for a
+// header the drain does not know.
+static unsigned accel_frame_len(uint8_t header) {
+  switch (header) {
+  case BMI08_FIFO_HEADER_ACC_FRM:
+    return IMU_DRAIN_ACCEL_FRAME;
+  case BMI08_FIFO_HEADER_SENS_TIME_FRM:
+    return IMU_DRAIN_TIME_FRAME;
+  case BMI08_FIFO_HEADER_SKIP_FRM:
+    return 1 + BMI08_FIFO_SKIP_FRM_LENGTH;
+  case BMI08_FIFO_HEADER_INPUT_CFG_FRM:
+  case BMI08_FIFO_SAMPLE_DROP_FRM:
+    return 1 + BMI08_FIFO_INPUT_CFG_LENGTH;
+  default:
+    return 0;
+  }
+}
+
+void imu_drain_init(struct imu_drain *d) { memset(d, 0, sizeof(*d)); }
+
+int imu_drain_accel(struct imu_drain *d, struct bmi08_dev *dev,
+                    struct imu_block *b, struct imu_block_clock *clk) {
+  uint8_t *const start = d->buf + IMU_DRAIN_HEAD;
+  const uint8_t *p, *end;
+  uint16_t avail;
+  uint32_t want, room;
+  uint8_t addr = BMI08_FIFO_DATA_ADDR;
+  uint8_t keep;
+
+  if (d == NULL || dev == NULL || b == NULL || clk == NULL)
+    return IMU_E_NULL_PTR;
+
+  d->rslt = bmi08a_get_fifo_length(&avail, dev);
+  if (d->rslt != BMI08_OK)
+    return IMU_E_IO;
+
+  // Cap at what the block can take: at most one sample per accel frame.
+  room = (uint32_t)(IMU_BLOCK_CAP - b->n) * IMU_DRAIN_ACCEL_FRAME;
+  if (room > IMU_DRAIN_BUF)
+    room = IMU_DRAIN_BUF - IMU_DRAIN_BUF % IMU_DRAIN_ACCEL_FRAME;
+  want = avail <= room ? avail : room;
+  // Past the fill level the accel sends the sensortime frame.
+  if (d->read_sensor_time && (uint32_t)avail + IMU_DRAIN_TIME_FRAME <= room)
+    want = avail + IMU_DRAIN_TIME_FRAME;
+  d->sensor_time_new = 0;
+
+  if (want > 0) {
+    if (dev->intf == BMI08_SPI_INTF)
+      addr |= BMI08_SPI_RD_MASK;
+    // The dummy byte lands on the last carried byte; put it back after.
+    keep = start[-1];
+    dev->intf_rslt = dev->read(addr, start - dev->dummy_byte,
+                               want + dev->dummy_byte, dev->intf_ptr_accel);
+    start[-1] = keep;
+    if (dev->intf_rslt != BMI08_INTF_RET_SUCCESS) {
+      d->rslt = BMI08_E_COM_FAIL;
+      return IMU_E_IO;
+    }
+    d->reads++;
+    d->bytes_read += want;
+  }
+
+  p = start - d->carry;
+  end = start + want;
+  while (p < end) {
+    unsigned len;
+
+    // Over-read marker: nothing more was in the FIFO.
+    if (p[0] == BMI08_FIFO_HEAD_OVER_READ_MSB) {
+      p = end;
+      break;
+    }
+    len = accel_frame_len(p[0]);
+
+    if (len == 0) {
+      d->carry = 0;
+      return IMU_E_FORMAT;
+    }
+    if ((size_t)(end - p) < len)
+      break;
+
+    switch (p[0]) {
+    case BMI08_FIFO_HEADER_ACC_FRM:
+      b->x[b->n] = le16(&p[1]);
+      b->y[b->n] = le16(&p[3]);
+      b->z[b->n] = le16(&p[5]);
+      b->t[b->n] = clk->next_ns;
+      clk->next_ns += clk->period_ns;
+      b->n++;
+      break;
+    case BMI08_FIFO_HEADER_SENS_TIME_FRM:
+      d->sensor_time =
+          (uint32_t)p[1] | (uint32_t)p[2] << 8 | (uint32_t)p[3] << 16;
+      d->sensor_time_new = 1;
+      break;
+    case BMI08_FIFO_HEADER_SKIP_FRM:
+      d->skipped += p[1];
+      clk->next_ns += (uint64_t)p[1] * clk->period_ns;
+      break;
+    default:
+      break;
+    }
+    p += len;
+  }
+
+  // Keep the unread head of a split frame just before the next read.
+  d->carry = (uint8_t)(end - p);
+  memmove(start - d->carry, p, d->carry);
+  return IMU_OK;
+}
+
+int imu_drain_gyro(struct imu_drain *d,
+                   const struct bmi08_gyr_fifo_config *conf,
+                   struct bmi08_dev *dev, struct imu_block *b,
+                   struct imu_block_clock *clk) {
+  uint8_t *const start = d->buf + IMU_DRAIN_HEAD;
+  uint32_t frame, frames, room;
+  uint8_t status;
+
+  if (d == NULL || conf == NULL || dev == NULL || b == NULL || clk == NULL)
+    return IMU_E_NULL_PTR;
+  if (conf->data_select != BMI08_GYRO_FIFO_XYZ_AXIS_ENABLED)
+    return IMU_E_INVALID_INPUT;
+
+  d->rslt = bmi08g_get_regs(BMI08_REG_GYRO_FIFO_STATUS, &status,
+                            BMI08_FIFO_STATUS_LENGTH, dev);
+  if (d->rslt != BMI08_OK)
+    return IMU_E_IO;
+  if (status & BMI08_GYRO_FIFO_OVERRUN_MASK)
+    d->overruns++;
+
+  frame = BMI08_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE + (conf->tag ? 2 : 0);
+  frames = status & BMI08_GYRO_FIFO_FRAME_COUNT_MASK;
+  room = (uint32_t)(IMU_BLOCK_CAP - b->n);
+  if (frames > room)
+    frames = room;
+  if (frames == 0)
+    return IMU_OK;
+
+  // Gyro frames are fixed size, so a whole number of them is never split.
+  d->rslt = bmi08g_get_regs(BMI08_REG_GYRO_FIFO_DATA, start, frames * frame,
+                            dev);
+  if (d->rslt != BMI08_OK)
+    return IMU_E_IO;
+  d->reads++;
+  d->bytes_read += frames * frame;
+
+  for (uint32_t i = 0; i < frames; i++) {
+    const uint8_t *p = start + i * frame;
+    b->x[b->n + i] = le16(&p[0]);
+    b->y[b->n + i] = le16(&p[2]);
+    b->z[b->n + i] = le16(&p[4]);
+    b->t[b->n + i] = clk->next_ns + (uint64_t)i * clk->period_ns;
+    if (conf->tag && d->sync != NULL)
+      imu_sync_note(d->sync, (uint16_t)le16(&p[6]), b->t[b->n + i]);
+  }
+  clk->next_ns += (uint64_t)frames * clk->period_ns;
+  b->n += frames;
+  return IMU_OK;
+}
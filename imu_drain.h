@@ -0,0 +1,61 @@
+#ifndef IMU_DRAIN_H
+#define IMU_DRAIN_H
+
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_block.h"
+#include "imu_sync.h"
+
+// Frame-aligned FIFO drain. bmi08a_read_fifo_data reads the whole buffer
+// plus whatever the caller sized it for and leaves the parser to stop at
+// the over-read marker. Here the byte counter (accel) or frame counter
+// (gyro) decides exactly how many bytes to clock out, so nothing past the
+// fill level is read unless a sensortime frame is asked for. When the
+// block has less room than the FIFO holds, the read is cut on a frame
+// boundary; a control frame can still shift an accel frame across the
+// cut, and its head is carried into the next drain instead of being
+// dropped.
+//
+// The accel appends a sensortime frame only when the host reads past the
+// fill level. With read_sensor_time set, imu_drain_accel reads 4 bytes
+// more than the fill level when the FIFO fits the block, so every full
+// drain yields one sensortime for anchoring the timeline (imu_merge.h).
+// Without it sensor_time is never updated and anchoring needs host time.
+
+#define IMU_DRAIN_BUF 1024 // accel FIFO size; the gyro holds 100 * 8 bytes
+#define IMU_DRAIN_ACCEL_FRAME (1 + BMI08_FIFO_ACCEL_LENGTH)
+#define IMU_DRAIN_TIME_FRAME (1u + BMI08_SENSOR_TIME_LENGTH)
+#define IMU_DRAIN_HEAD 8 // room for a carried frame plus the SPI dummy byte
+
+struct imu_drain {
+  uint8_t buf[IMU_DRAIN_HEAD + IMU_DRAIN_BUF];
+  uint8_t carry; // partial frame bytes kept right before buf + HEAD
+  uint8_t read_sensor_time; // opt-in over-read of one sensortime frame
+  uint8_t sensor_time_new;  // sensor_time was updated by the last drain
+  uint32_t sensor_time;
+  uint32_t skipped;
+  uint32_t reads;
+  uint32_t bytes_read;
+  uint32_t overruns; // gyro FIFO overrun flags seen
+  int8_t rslt;       // last driver code
+  struct imu_sync_index *sync; // optional, gets tagged gyro frames
+};
+
+void imu_drain_init(struct imu_drain *d);
+
+// Appends every complete frame that fits into b. Accel must be in header
+// mode, and sensortime frames enabled for read_sensor_time to yield one.
+// Returns IMU_OK, IMU_E_FORMAT on an unknown header (the rest of the read
+// is dropped) or IMU_E_IO with the driver code in d->rslt.
+int imu_drain_accel(struct imu_drain *d, struct bmi08_dev *dev,
+                    struct imu_block *b, struct imu_block_clock *clk);
+
+// conf is the gyro FIFO config last written with bmi08g_set_fifo_config;
+// only its tag and data_select are used, so no config read per drain.
+int imu_drain_gyro(struct imu_drain *d,
+                   const struct bmi08_gyr_fifo_config *conf,
+                   struct bmi08_dev *dev, struct imu_block *b,
+                   struct imu_block_clock *clk);
+
+#endif // IMU_DRAIN_H
@@ -0,0 +1,24 @@
+#include "imu_error.h"
+
+const char *imu_get_error_string(int error_code) {
+  switch (error_code) {
+  case IMU_OK:
+    return "success";
+  case IMU_E_NULL_PTR:
+    return "null pointer";
+  case IMU_E_INVALID_INPUT:
+    return "invalid input";
+  case IMU_E_NOT_READY:
+    return "not enough data";
+  case IMU_E_NOT_FOUND:
+    return "not found";
+  case IMU_E_FULL:
+    return "capacity exhausted";
+  case IMU_E_IO:
+    return "I/O error";
+  case IMU_E_FORMAT:
+    return "bad data format";
+  default:
+    return "unknown error";
+  }
+}
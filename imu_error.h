@@ -0,0 +1,17 @@
+#ifndef IMU_ERROR_H
+#define IMU_ERROR_H
+
+// Status codes shared by the host-side imu_* modules. Zero is success,
+// negative values are errors, positive values are informational warnings.
+#define IMU_OK 0
+#define IMU_E_NULL_PTR -1
+#define IMU_E_INVALID_INPUT -2
+#define IMU_E_NOT_READY -3
+#define IMU_E_NOT_FOUND -4
+#define IMU_E_FULL -5
+#define IMU_E_IO -6
+#define IMU_E_FORMAT -7
+
+const char *imu_get_error_string(int error_code);
+
+#endif // IMU_ERROR_H
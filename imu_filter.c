@@ -0,0 +1,289 @@
+#include "imu_filter.h"
+#include "imu_error.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static struct imu_filter_stage *new_stage(struct imu_filter_pipeline *p,
+                                          int parent, int *idx) {
+  struct imu_filter_stage *s;
+
+  if (p->count == IMU_FILTER_MAX_STAGES)
+    return NULL;
+  if (parent < IMU_FILTER_INPUT || parent >= (int)p->count)
+    return NULL;
+
+  *idx = (int)p->count;
+  s = &p->stages[p->count];
+  memset(s, 0, sizeof(*s));
+  s->parent = parent;
+  return s;
+}
+
+void imu_filter_init(struct imu_filter_pipeline *p) { p->count = 0; }
+
+int imu_filter_add_cic(struct imu_filter_pipeline *p, int parent,
+                       unsigned order, unsigned decim) {
+  struct imu_filter_stage *s;
+  unsigned growth = 0;
+  int idx;
+
+  if (p == NULL)
+    return IMU_E_NULL_PTR;
+  if (parent != IMU_FILTER_INPUT || order == 0 || order > IMU_CIC_MAX_ORDER ||
+      decim < 2)
+    return IMU_E_INVALID_INPUT;
+
+  // Registers wrap at 32 bits, which is exact as long as the output word
+  // (16 + order * log2(decim) bits) still fits.
+  while ((1u << growth) < decim)
+    growth++;
+  if (16 + order * growth > 32)
+    return IMU_E_INVALID_INPUT;
+
+  s = new_stage(p, parent, &idx);
+  if (s == NULL)
+    return IMU_E_FULL;
+  s->kind = IMU_FILTER_CIC;
+  s->u.cic.order = order;
+  s->u.cic.decim = decim;
+  s->u.cic.gain = (float)(1.0 / pow((double)decim, (double)order));
+  p->count++;
+  return idx;
+}
+
+int imu_filter_add_fir(struct imu_filter_pipeline *p, int parent,
+                       const float *taps, unsigned ntaps, unsigned decim) {
+  struct imu_filter_stage *s;
+  int idx;
+
+  if (p == NULL || taps == NULL)
+    return IMU_E_NULL_PTR;
+  if (ntaps == 0 || ntaps > IMU_FIR_MAX_TAPS || decim == 0)
+    return IMU_E_INVALID_INPUT;
+
+  s = new_stage(p, parent, &idx);
+  if (s == NULL)
+    return IMU_E_FULL;
+  s->kind = IMU_FILTER_FIR;
+  s->u.fir.ntaps = ntaps;
+  s->u.fir.decim = decim;
+  // Stored reversed so the window, oldest sample first, is a plain dot.
+  for (unsigned i = 0; i < ntaps; i++)
+    s->u.fir.taps[i] = taps[ntaps - 1 - i];
+  p->count++;
+  return idx;
+}
+
+int imu_filter_add_biquad(struct imu_filter_pipeline *p, int parent,
+                          const struct imu_biquad_coef *sec, unsigned nsec) {
+  struct imu_filter_stage *s;
+  int idx;
+
+  if (p == NULL || sec == NULL)
+    return IMU_E_NULL_PTR;
+  if (nsec == 0 || nsec > IMU_BIQUAD_MAX_SECTIONS)
+    return IMU_E_INVALID_INPUT;
+
+  s = new_stage(p, parent, &idx);
+  if (s == NULL)
+    return IMU_E_FULL;
+  s->kind = IMU_FILTER_BIQUAD;
+  s->u.biquad.nsec = nsec;
+  memcpy(s->u.biquad.sec, sec, nsec * sizeof(*sec));
+  p->count++;
+  return idx;
+}
+
+static size_t run_cic(struct imu_cic *c, const int16_t *const in[3], size_t n,
+                      float out[3][IMU_FILTER_MAX_BLOCK]) {
+  const unsigned order = c->order;
+  unsigned phase = c->phase;
+  size_t n_out = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    int emit = ++phase == c->decim;
+
+    for (int a = 0; a < 3; a++) {
+      uint32_t v = (uint32_t)(int32_t)in[a][i];
+      for (unsigned k = 0; k < order; k++) {
+        c->integ[a][k] += v;
+        v = c->integ[a][k];
+      }
+      if (emit) {
+        for (unsigned k = 0; k < order; k++) {
+          uint32_t d = v - c->comb[a][k];
+          c->comb[a][k] = v;
+          v = d;
+        }
+        out[a][n_out] = (float)(int32_t)v * c->gain;
+      }
+    }
+    if (emit) {
+      n_out++;
+      phase = 0;
+    }
+  }
+  c->phase = phase;
+  return n_out;
+}
+
+static float fir_dot(const float *restrict taps, const float *restrict win,
+                     unsigned n) {
+  float acc = 0.0f;
+
+#pragma omp simd reduction(+ : acc)
+  for (unsigned k = 0; k < n; k++)
+    acc += taps[k] * win[k];
+  return acc;
+}
+
+static size_t run_fir(struct imu_fir *f, const float *const in[3], size_t n,
+                      float out[3][IMU_FILTER_MAX_BLOCK]) {
+  const unsigned ntaps = f->ntaps;
+  unsigned phase = f->phase, pos = f->pos;
+  size_t n_out = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    for (int a = 0; a < 3; a++) {
+      f->hist[a][pos] = in[a][i];
+      f->hist[a][pos + ntaps] = in[a][i];
+    }
+    pos = pos + 1 == ntaps ? 0 : pos + 1;
+    if (++phase == f->decim) {
+      phase = 0;
+      for (int a = 0; a < 3; a++)
+        out[a][n_out] = fir_dot(f->taps, &f->hist[a][pos], ntaps);
+      n_out++;
+    }
+  }
+  f->phase = phase;
+  f->pos = pos;
+  return n_out;
+}
+
+static size_t run_biquad(struct imu_biquad *b, const float *const in[3],
+                         size_t n, float out[3][IMU_FILTER_MAX_BLOCK]) {
+  for (int a = 0; a < 3; a++) {
+    const float *src = in[a];
+    for (unsigned s = 0; s < b->nsec; s++) {
+      const struct imu_biquad_coef c = b->sec[s];
+      float z1 = b->z1[a][s], z2 = b->z2[a][s];
+      for (size_t i = 0; i < n; i++) {
+        float x = src[i];
+        float y = c.b0 * x + z1;
+        z1 = c.b1 * x - c.a1 * y + z2;
+        z2 = c.b2 * x - c.a2 * y;
+        out[a][i] = y;
+      }
+      b->z1[a][s] = z1;
+      b->z2[a][s] = z2;
+      src = out[a];
+    }
+  }
+  return n;
+}
+
+int imu_filter_process(struct imu_filter_pipeline *p, const int16_t *x,
+                       const int16_t *y, const int16_t *z, size_t n) {
+  const int16_t *const raw[3] = {x, y, z};
+
+  if (p == NULL || x == NULL || y == NULL || z == NULL)
+    return IMU_E_NULL_PTR;
+  if (n > IMU_FILTER_MAX_BLOCK)
+    return IMU_E_INVALID_INPUT;
+
+  // Converted once and shared by every float stage reading the input.
+  for (int a = 0; a < 3; a++) {
+    for (size_t i = 0; i < n; i++)
+      p->in[a][i] = (float)raw[a][i];
+  }
+  p->n_in = n;
+
+  for (unsigned s = 0; s < p->count; s++) {
+    struct imu_filter_stage *st = &p->stages[s];
+    const float *src[3];
+    size_t n_src;
+
+    if (st->parent == IMU_FILTER_INPUT) {
+      for (int a = 0; a < 3; a++)
+        src[a] = p->in[a];
+      n_src = n;
+    } else {
+      const struct imu_filter_stage *par = &p->stages[st->parent];
+      for (int a = 0; a < 3; a++)
+        src[a] = par->out[a];
+      n_src = par->n_out;
+    }
+
+    switch (st->kind) {
+    case IMU_FILTER_CIC:
+      st->n_out = run_cic(&st->u.cic, raw, n, st->out);
+      break;
+    case IMU_FILTER_FIR:
+      st->n_out = run_fir(&st->u.fir, src, n_src, st->out);
+      break;
+    case IMU_FILTER_BIQUAD:
+      st->n_out = run_biquad(&st->u.biquad, src, n_src, st->out);
+      break;
+    }
+  }
+  return IMU_OK;
+}
+
+int imu_filter_process_block(struct imu_filter_pipeline *p,
+                             const struct imu_block *b) {
+  if (b == NULL)
+    return IMU_E_NULL_PTR;
+  return imu_filter_process(p, b->x, b->y, b->z, b->n);
+}
+
+const float *imu_filter_output(const struct imu_filter_pipeline *p, int stage,
+                               int axis, size_t *n) {
+  if (p == NULL || stage < 0 || stage >= (int)p->count || axis < 0 ||
+      axis > 2)
+    return NULL;
+  if (n != NULL)
+    *n = p->stages[stage].n_out;
+  return p->stages[stage].out[axis];
+}
+
+int imu_fir_lowpass(float *taps, unsigned ntaps, float cutoff) {
+  double sum = 0.0;
+  double mid = (ntaps - 1) / 2.0;
+
+  if (taps == NULL)
+    return IMU_E_NULL_PTR;
+  if (ntaps == 0 || cutoff <= 0.0f || cutoff >= 0.5f)
+    return IMU_E_INVALID_INPUT;
+
+  for (unsigned i = 0; i < ntaps; i++) {
+    double t = i - mid;
+    double sinc = t == 0.0 ? 2.0 * cutoff
+                           : sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+    double w =
+        ntaps > 1 ? 0.54 - 0.46 * cos(2.0 * M_PI * i / (ntaps - 1)) : 1.0;
+    taps[i] = (float)(sinc * w);
+    sum += taps[i];
+  }
+  for (unsigned i = 0; i < ntaps; i++)
+    taps[i] = (float)(taps[i] / sum);
+  return IMU_OK;
+}
+
+void imu_biquad_lowpass(struct imu_biquad_coef *c, float fs, float fc,
+                        float q) {
+  double w0 = 2.0 * M_PI * fc / fs;
+  double alpha = sin(w0) / (2.0 * q);
+  double cw = cos(w0);
+  double a0 = 1.0 + alpha;
+
+  c->b0 = (float)((1.0 - cw) / 2.0 / a0);
+  c->b1 = (float)((1.0 - cw) / a0);
+  c->b2 = c->b0;
+  c->a1 = (float)(-2.0 * cw / a0);
+  c->a2 = (float)((1.0 - alpha) / a0);
+}
@@ -0,0 +1,106 @@
+#ifndef IMU_FILTER_H
+#define IMU_FILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+#define IMU_FILTER_MAX_STAGES 8
+#define IMU_FILTER_MAX_BLOCK 256
+#define IMU_FIR_MAX_TAPS 64
+#define IMU_BIQUAD_MAX_SECTIONS 4
+#define IMU_CIC_MAX_ORDER 4
+
+// Parent index meaning "the raw block passed to imu_filter_process".
+#define IMU_FILTER_INPUT (-1)
+
+enum imu_filter_kind { IMU_FILTER_CIC, IMU_FILTER_FIR, IMU_FILTER_BIQUAD };
+
+struct imu_biquad_coef {
+  float b0, b1, b2;
+  float a1, a2;
+};
+
+// Integer CIC decimator. Runs on the raw int16 input with wrapping 32-bit
+// registers, so it only accepts IMU_FILTER_INPUT as its parent.
+struct imu_cic {
+  unsigned order;
+  unsigned decim;
+  unsigned phase;
+  float gain;
+  uint32_t integ[3][IMU_CIC_MAX_ORDER];
+  uint32_t comb[3][IMU_CIC_MAX_ORDER];
+};
+
+// Decimating FIR that only evaluates the outputs it keeps, i.e. the
+// polyphase cost of ntaps / decim multiplies per input sample. The history
+// is mirrored so every window is contiguous.
+struct imu_fir {
+  unsigned ntaps;
+  unsigned decim;
+  unsigned phase;
+  unsigned pos;
+  float taps[IMU_FIR_MAX_TAPS];
+  float hist[3][2 * IMU_FIR_MAX_TAPS];
+};
+
+// Cascade of transposed direct form II sections.
+struct imu_biquad {
+  unsigned nsec;
+  struct imu_biquad_coef sec[IMU_BIQUAD_MAX_SECTIONS];
+  float z1[3][IMU_BIQUAD_MAX_SECTIONS];
+  float z2[3][IMU_BIQUAD_MAX_SECTIONS];
+};
+
+struct imu_filter_stage {
+  enum imu_filter_kind kind;
+  int parent;
+  union {
+    struct imu_cic cic;
+    struct imu_fir fir;
+    struct imu_biquad biquad;
+  } u;
+  size_t n_out;
+  float out[3][IMU_FILTER_MAX_BLOCK];
+};
+
+// A tree of stages fed from one raw block. Each stage reads its parent's
+// output, so consumers at lower rates reuse the work done for higher ones,
+// e.g. 2 kHz -> FIR/2 (1 kHz control) -> FIR/10 (100 Hz logging) -> ...
+struct imu_filter_pipeline {
+  unsigned count;
+  size_t n_in;
+  float in[3][IMU_FILTER_MAX_BLOCK];
+  struct imu_filter_stage stages[IMU_FILTER_MAX_STAGES];
+};
+
+void imu_filter_init(struct imu_filter_pipeline *p);
+
+// The add functions return the new stage index or a negative IMU_E_* code.
+// Parents must already exist.
+int imu_filter_add_cic(struct imu_filter_pipeline *p, int parent,
+                       unsigned order, unsigned decim);
+int imu_filter_add_fir(struct imu_filter_pipeline *p, int parent,
+                       const float *taps, unsigned ntaps, unsigned decim);
+int imu_filter_add_biquad(struct imu_filter_pipeline *p, int parent,
+                          const struct imu_biquad_coef *sec, unsigned nsec);
+
+// Pushes up to IMU_FILTER_MAX_BLOCK samples per axis through every stage.
+int imu_filter_process(struct imu_filter_pipeline *p, const int16_t *x,
+                       const int16_t *y, const int16_t *z, size_t n);
+int imu_filter_process_block(struct imu_filter_pipeline *p,
+                             const struct imu_block *b);
+
+// Output of a stage for the last processed block.
+const float *imu_filter_output(const struct imu_filter_pipeline *p, int stage,
+                               int axis, size_t *n);
+
+// Windowed-sinc (Hamming) low-pass; cutoff is a fraction of the input rate.
+int imu_fir_lowpass(float *taps, unsigned ntaps, float cutoff);
+
+// RBJ cookbook low-pass section.
+void imu_biquad_lowpass(struct imu_biquad_coef *c, float fs, float fc,
+                        float q);
+
+#endif // IMU_FILTER_H
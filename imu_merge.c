@@ -0,0 +1,211 @@
+#include "imu_merge.h"
+#include "imu_error.h"
+#include <math.h>
+#include <string.h>
+
+// Anchors further than this from the nominal period are treated as
+// jitter, not as the sensor clock running fast or slow.
+#define IMU_TIMELINE_MAX_DRIFT 0.1
+
+void imu_timeline_init(struct imu_timeline *tl, float odr_hz, float alpha) {
+  memset(tl, 0, sizeof(*tl));
+  tl->nominal_ns = (uint32_t)lrint(1e9 / odr_hz);
+  tl->period_ns = tl->nominal_ns;
+  tl->alpha = alpha;
+}
+
+static void timeline_anchor(struct imu_timeline *tl, uint64_t idx,
+                            double t_ns) {
+  double predicted, lo, hi;
+
+  if (!tl->anchored) {
+    tl->anchor_ns = t_ns;
+    tl->anchor_idx = idx;
+    tl->anchored = 1;
+    return;
+  }
+  if (idx > tl->anchor_idx) {
+    double measured = (t_ns - tl->anchor_ns) / (double)(idx - tl->anchor_idx);
+    lo = tl->nominal_ns * (1.0 - IMU_TIMELINE_MAX_DRIFT);
+    hi = tl->nominal_ns * (1.0 + IMU_TIMELINE_MAX_DRIFT);
+    measured = measured < lo ? lo : measured > hi ? hi : measured;
+    tl->period_ns += tl->alpha * (measured - tl->period_ns);
+  }
+  predicted = tl->anchor_ns + ((double)idx - (double)tl->anchor_idx) *
+                                  tl->period_ns;
+  tl->anchor_ns = predicted + tl->alpha * (t_ns - predicted);
+  tl->anchor_idx = idx;
+}
+
+void imu_timeline_stamp(struct imu_timeline *tl, struct imu_block *b,
+                        size_t first, const uint64_t *anchor_ns) {
+  const double base = tl->anchor_ns - (double)tl->anchor_idx * tl->period_ns;
+  size_t n;
+
+  if (first >= b->n)
+    return;
+  n = b->n - first;
+  if (anchor_ns != NULL) {
+    timeline_anchor(tl, tl->count + n - 1, (double)*anchor_ns);
+    imu_timeline_stamp(tl, b, first, NULL);
+    return;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    double t = base + (double)(tl->count + i) * tl->period_ns;
+    b->t[first + i] = t > 0.0 ? (uint64_t)llrint(t) : 0;
+  }
+  tl->count += n;
+}
+
+uint64_t imu_timeline_ticks_ns(struct imu_timeline *tl, uint32_t ticks) {
+  ticks &= (1u << IMU_SENSORTIME_BITS) - 1;
+  if (ticks < tl->last_ticks)
+    tl->tick_wraps++;
+  tl->last_ticks = ticks;
+  // 39062.5 ns per tick.
+  return ((tl->tick_wraps << IMU_SENSORTIME_BITS | ticks) * 78125u) / 2u;
+}
+
+void imu_merge_init(struct imu_merge *m, enum imu_merge_mode mode,
+                    uint64_t grid_ns) {
+  m->mode = mode;
+  m->grid_ns = grid_ns;
+  m->next_ns = 0;
+  m->started = 0;
+  m->accel.n = 0;
+  m->gyro.n = 0;
+}
+
+static int queue_push(struct imu_merge_queue *q, const struct imu_block *b) {
+  if (b == NULL)
+    return IMU_E_NULL_PTR;
+  if (q->n + b->n > IMU_MERGE_CAP)
+    return IMU_E_FULL;
+
+  memcpy(&q->v[0][q->n], b->x, b->n * sizeof(int16_t));
+  memcpy(&q->v[1][q->n], b->y, b->n * sizeof(int16_t));
+  memcpy(&q->v[2][q->n], b->z, b->n * sizeof(int16_t));
+  memcpy(&q->t[q->n], b->t, b->n * sizeof(uint64_t));
+  q->n += b->n;
+  return IMU_OK;
+}
+
+int imu_merge_push_accel(struct imu_merge *m, const struct imu_block *b) {
+  return queue_push(&m->accel, b);
+}
+
+int imu_merge_push_gyro(struct imu_merge *m, const struct imu_block *b) {
+  return queue_push(&m->gyro, b);
+}
+
+// Value of q at time t, with *cur a monotone cursor so a whole run costs
+// one pass over the queue.
+static void interp(const struct imu_merge_queue *q, size_t *cur, uint64_t t,
+                   int16_t out[3]) {
+  size_t j = *cur;
+
+  while (j + 1 < q->n && q->t[j + 1] <= t)
+    j++;
+  *cur = j;
+  if (j + 1 == q->n || q->t[j] >= t) {
+    for (int a = 0; a < 3; a++)
+      out[a] = q->v[a][j];
+    return;
+  }
+
+  double w = (double)(t - q->t[j]) / (double)(q->t[j + 1] - q->t[j]);
+  for (int a = 0; a < 3; a++) {
+    double v0 = q->v[a][j], v1 = q->v[a][j + 1];
+    out[a] = (int16_t)lrint(v0 + (v1 - v0) * w);
+  }
+}
+
+static void emit(struct imu_block6 *out, uint64_t t,
+                 const struct imu_merge_queue *accel, size_t *ca,
+                 const struct imu_merge_queue *gyro, size_t *cg) {
+  int16_t a[3], g[3];
+  size_t k = out->n++;
+
+  interp(accel, ca, t, a);
+  interp(gyro, cg, t, g);
+  out->ax[k] = a[0];
+  out->ay[k] = a[1];
+  out->az[k] = a[2];
+  out->gx[k] = g[0];
+  out->gy[k] = g[1];
+  out->gz[k] = g[2];
+  out->t[k] = t;
+}
+
+// Drops samples before the cursor; the one at it still brackets the next
+// output instant.
+static void queue_trim(struct imu_merge_queue *q, size_t keep_from) {
+  size_t n = q->n - keep_from;
+
+  if (keep_from == 0)
+    return;
+  for (int a = 0; a < 3; a++)
+    memmove(q->v[a], &q->v[a][keep_from], n * sizeof(int16_t));
+  memmove(q->t, &q->t[keep_from], n * sizeof(uint64_t));
+  q->n = n;
+}
+
+int imu_merge_run(struct imu_merge *m, struct imu_block6 *out) {
+  const struct imu_merge_queue *A = &m->accel, *G = &m->gyro;
+  size_t ca = 0, cg = 0;
+  uint64_t lo, hi;
+  int rslt = IMU_OK;
+
+  if (m == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  if (A->n == 0 || G->n == 0)
+    return IMU_OK;
+
+  // Only instants inside both streams can be interpolated.
+  lo = A->t[0] > G->t[0] ? A->t[0] : G->t[0];
+  hi = A->t[A->n - 1] < G->t[G->n - 1] ? A->t[A->n - 1] : G->t[G->n - 1];
+
+  if (m->mode == IMU_MERGE_GRID) {
+    if (m->grid_ns == 0)
+      return IMU_E_INVALID_INPUT;
+    if (!m->started || m->next_ns < lo) {
+      m->next_ns = lo;
+      m->started = 1;
+    }
+    while (m->next_ns <= hi) {
+      if (out->n == IMU_MERGE_CAP) {
+        rslt = IMU_E_FULL;
+        break;
+      }
+      emit(out, m->next_ns, A, &ca, G, &cg);
+      m->next_ns += m->grid_ns;
+    }
+  } else {
+    size_t ia = 0, ig = 0;
+
+    while (ia < A->n || ig < G->n) {
+      uint64_t ta = ia < A->n ? A->t[ia] : UINT64_MAX;
+      uint64_t tg = ig < G->n ? G->t[ig] : UINT64_MAX;
+      uint64_t t = ta < tg ? ta : tg;
+
+      if (t > hi)
+        break;
+      if (t >= lo && (!m->started || t > m->next_ns)) {
+        if (out->n == IMU_MERGE_CAP) {
+          rslt = IMU_E_FULL;
+          break;
+        }
+        emit(out, t, A, &ca, G, &cg);
+        m->next_ns = t;
+        m->started = 1;
+      }
+      ia += ta == t;
+      ig += tg == t;
+    }
+  }
+
+  queue_trim(&m->accel, ca);
+  queue_trim(&m->gyro, cg);
+  return rslt;
+}
@@ -0,0 +1,91 @@
+#ifndef IMU_MERGE_H
+#define IMU_MERGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Common timeline for the accel and gyro FIFOs. Each stream gets a
+// timeline that stamps samples from its ODR and is pulled onto real time
+// by anchors: an accel sensortime frame, or the host clock at the end of a
+// drain. The merger then lines both streams up as 6-axis samples, either
+// at every accel and gyro instant or on a fixed output grid, so neither
+// data-sync mode nor extra register reads are needed.
+
+#define IMU_MERGE_CAP (2 * IMU_BLOCK_CAP)
+
+// Sensortime is a 24-bit counter of 39.0625 us ticks.
+#define IMU_SENSORTIME_BITS 24
+
+struct imu_timeline {
+  uint32_t nominal_ns; // 1e9 / ODR
+  double period_ns;    // tracked sample period
+  double anchor_ns;    // model: t(i) = anchor_ns + (i - anchor_idx) * period
+  uint64_t anchor_idx;
+  uint64_t count; // samples stamped so far
+  float alpha;    // anchor weight, 1 for exact anchors like sensortime
+  int anchored;
+  uint32_t last_ticks;
+  uint64_t tick_wraps;
+};
+
+void imu_timeline_init(struct imu_timeline *tl, float odr_hz, float alpha);
+
+// Stamps b->t[first .. b->n) as the next samples of the stream. When
+// anchor_ns is not NULL, the last of them is taken to be at *anchor_ns and
+// the period and phase are corrected first.
+void imu_timeline_stamp(struct imu_timeline *tl, struct imu_block *b,
+                        size_t first, const uint64_t *anchor_ns);
+
+// Unwraps a 24-bit sensortime reading into ns on the sensor's own clock:
+// counted from the counter's zero, plus the wraps seen since
+// imu_timeline_init. It is not relative to the first reading nor to the
+// timeline's anchor, so pass every reading to catch each wrap (655 s).
+uint64_t imu_timeline_ticks_ns(struct imu_timeline *tl, uint32_t ticks);
+
+enum imu_merge_mode {
+  IMU_MERGE_UNION, // one output per accel or gyro sample instant
+  IMU_MERGE_GRID,  // one output every grid_ns
+};
+
+struct imu_block6 {
+  _Alignas(IMU_BLOCK_ALIGN) int16_t ax[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t ay[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t az[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t gx[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t gy[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) int16_t gz[IMU_MERGE_CAP];
+  _Alignas(IMU_BLOCK_ALIGN) uint64_t t[IMU_MERGE_CAP];
+  size_t n;
+};
+
+// Stamped samples of one stream not yet merged past.
+struct imu_merge_queue {
+  int16_t v[3][IMU_MERGE_CAP];
+  uint64_t t[IMU_MERGE_CAP];
+  size_t n;
+};
+
+struct imu_merge {
+  enum imu_merge_mode mode;
+  uint64_t grid_ns;
+  uint64_t next_ns; // next grid point, or last emitted union instant
+  int started;
+  struct imu_merge_queue accel;
+  struct imu_merge_queue gyro;
+};
+
+void imu_merge_init(struct imu_merge *m, enum imu_merge_mode mode,
+                    uint64_t grid_ns);
+
+// Queue stamped blocks; timestamps must not go backwards within a stream.
+int imu_merge_push_accel(struct imu_merge *m, const struct imu_block *b);
+int imu_merge_push_gyro(struct imu_merge *m, const struct imu_block *b);
+
+// Emits every output instant both streams already cover, linearly
+// interpolating each stream at that time. Appends to out and returns
+// IMU_E_FULL when out filled up first; call again after draining it.
+int imu_merge_run(struct imu_merge *m, struct imu_block6 *out);
+
+#endif // IMU_MERGE_H
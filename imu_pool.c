@@ -0,0 +1,145 @@
+#include "imu_pool.h"
+#include "imu_error.h"
+
+#define HEAD_SLOT(h) ((uint32_t)(h))
+#define HEAD_TAG(h) ((uint32_t)((h) >> 32))
+#define MAKE_HEAD(tag, slot) ((uint64_t)(tag) << 32 | (uint32_t)(slot))
+
+// Slots are stored 1-based in the free list so 0 can mean "none".
+static void push_free(struct imu_pool *p, uint32_t idx) {
+  uint64_t old = atomic_load_explicit(&p->head, memory_order_relaxed);
+  uint64_t neu;
+
+  do {
+    atomic_store_explicit(&p->next[idx], HEAD_SLOT(old), memory_order_relaxed);
+    neu = MAKE_HEAD(HEAD_TAG(old) + 1, idx + 1);
+  } while (!atomic_compare_exchange_weak_explicit(
+      &p->head, &old, neu, memory_order_release, memory_order_relaxed));
+}
+
+static uint32_t slot_of(const struct imu_pool *p, const void *obj) {
+  return (uint32_t)(((const uint8_t *)obj - p->base) / p->slot_size);
+}
+
+int imu_pool_init(struct imu_pool *p, void *storage, size_t slot_size,
+                  uint32_t count) {
+  if (p == NULL || storage == NULL)
+    return IMU_E_NULL_PTR;
+  if (slot_size == 0 || count == 0 || count > IMU_POOL_MAX_SLOTS)
+    return IMU_E_INVALID_INPUT;
+
+  p->base = storage;
+  p->slot_size = slot_size;
+  p->count = count;
+  atomic_init(&p->head, 0);
+  atomic_init(&p->in_use, 0);
+  atomic_init(&p->high_water, 0);
+  atomic_init(&p->exhausted, 0);
+  for (uint32_t i = 0; i < IMU_POOL_MAX_SLOTS; i++) {
+    atomic_init(&p->next[i], 0);
+    atomic_init(&p->refs[i], 0);
+  }
+  // Pushed in reverse so the first gets hand out slot 0, 1, ...
+  for (uint32_t i = count; i-- > 0;)
+    push_free(p, i);
+  return IMU_OK;
+}
+
+void *imu_pool_get(struct imu_pool *p) {
+  uint64_t old = atomic_load_explicit(&p->head, memory_order_acquire);
+  uint32_t idx, used, hw;
+
+  do {
+    if (HEAD_SLOT(old) == 0) {
+      atomic_fetch_add_explicit(&p->exhausted, 1, memory_order_relaxed);
+      return NULL;
+    }
+    idx = HEAD_SLOT(old) - 1;
+    // The tag makes a stale next[] read fail the exchange if the slot was
+    // taken and returned in between (ABA).
+  } while (!atomic_compare_exchange_weak_explicit(
+      &p->head, &old,
+      MAKE_HEAD(HEAD_TAG(old) + 1,
+                atomic_load_explicit(&p->next[idx], memory_order_relaxed)),
+      memory_order_acquire, memory_order_acquire));
+
+  atomic_store_explicit(&p->refs[idx], 1, memory_order_relaxed);
+  used = atomic_fetch_add_explicit(&p->in_use, 1, memory_order_relaxed) + 1;
+  hw = atomic_load_explicit(&p->high_water, memory_order_relaxed);
+  while (used > hw && !atomic_compare_exchange_weak_explicit(
+                          &p->high_water, &hw, used, memory_order_relaxed,
+                          memory_order_relaxed))
+    ;
+  return p->base + (size_t)idx * p->slot_size;
+}
+
+void imu_pool_ref(struct imu_pool *p, void *obj) {
+  atomic_fetch_add_explicit(&p->refs[slot_of(p, obj)], 1,
+                            memory_order_relaxed);
+}
+
+void imu_pool_put(struct imu_pool *p, void *obj) {
+  uint32_t idx;
+
+  if (obj == NULL)
+    return;
+  idx = slot_of(p, obj);
+  // acq_rel so every consumer's reads of the object happen before reuse.
+  if (atomic_fetch_sub_explicit(&p->refs[idx], 1, memory_order_acq_rel) != 1)
+    return;
+  atomic_fetch_sub_explicit(&p->in_use, 1, memory_order_relaxed);
+  push_free(p, idx);
+}
+
+uint32_t imu_pool_available(const struct imu_pool *p) {
+  return p->count -
+         atomic_load_explicit(&((struct imu_pool *)p)->in_use,
+                              memory_order_relaxed);
+}
+
+int imu_pool_get_fifo(struct imu_pool *p, struct bmi08_fifo_frame *fifo) {
+  if (p == NULL || fifo == NULL)
+    return IMU_E_NULL_PTR;
+  if (p->slot_size > UINT16_MAX)
+    return IMU_E_INVALID_INPUT;
+
+  fifo->data = imu_pool_get(p);
+  if (fifo->data == NULL)
+    return IMU_E_FULL;
+  fifo->length = (uint16_t)p->slot_size;
+  return IMU_OK;
+}
+
+void imu_pool_put_fifo(struct imu_pool *p, struct bmi08_fifo_frame *fifo) {
+  imu_pool_put(p, fifo->data);
+  fifo->data = NULL;
+  fifo->length = 0;
+}
+
+void imu_handoff_init(struct imu_handoff *h) {
+  atomic_init(&h->head, 0);
+  atomic_init(&h->tail, 0);
+}
+
+int imu_handoff_push(struct imu_handoff *h, void *obj) {
+  size_t head = atomic_load_explicit(&h->head, memory_order_relaxed);
+  size_t tail = atomic_load_explicit(&h->tail, memory_order_acquire);
+
+  if (head - tail == IMU_HANDOFF_CAP)
+    return IMU_E_FULL;
+  h->slot[head & (IMU_HANDOFF_CAP - 1)] = obj;
+  atomic_store_explicit(&h->head, head + 1, memory_order_release);
+  return IMU_OK;
+}
+
+void *imu_handoff_pop(struct imu_handoff *h) {
+  size_t tail = atomic_load_explicit(&h->tail, memory_order_relaxed);
+  size_t head = atomic_load_explicit(&h->head, memory_order_acquire);
+  void *obj;
+
+  if (tail == head)
+    return NULL;
+  obj = h->slot[tail & (IMU_HANDOFF_CAP - 1)];
+  atomic_store_explicit(&h->tail, tail + 1, memory_order_release);
+  return obj;
+}
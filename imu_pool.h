@@ -0,0 +1,62 @@
+#ifndef IMU_POOL_H
+#define IMU_POOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+
+// Fixed-capacity object pool over caller-provided storage, e.g. FIFO byte
+// buffers or struct imu_block arrays. Get/put are lock-free (a Treiber
+// stack with a tagged head), so reader and consumer threads exchange
+// buffers without malloc or a mutex in steady state. Objects are
+// refcounted: the reader hands one block to several consumers and the
+// last put returns it to the pool.
+
+#define IMU_POOL_MAX_SLOTS 64
+#define IMU_HANDOFF_CAP 32 // power of two
+
+struct imu_pool {
+  uint8_t *base;
+  size_t slot_size;
+  uint32_t count;
+  _Atomic uint64_t head; // tag << 32 | (slot + 1), 0 when empty
+  _Atomic uint32_t next[IMU_POOL_MAX_SLOTS];
+  _Atomic uint32_t refs[IMU_POOL_MAX_SLOTS];
+  _Atomic uint32_t in_use;
+  _Atomic uint32_t high_water;
+  _Atomic uint32_t exhausted; // failed gets
+};
+
+// Single-producer, single-consumer ring of pool objects between two
+// threads; one per reader/consumer pair.
+struct imu_handoff {
+  _Atomic size_t head;
+  _Atomic size_t tail;
+  void *slot[IMU_HANDOFF_CAP];
+};
+
+// storage holds count objects of slot_size bytes each; slot_size keeps
+// the stride, so pass sizeof of an aligned type to keep every slot aligned.
+int imu_pool_init(struct imu_pool *p, void *storage, size_t slot_size,
+                  uint32_t count);
+
+// Returns an object with one reference, or NULL when the pool is empty.
+void *imu_pool_get(struct imu_pool *p);
+void imu_pool_ref(struct imu_pool *p, void *obj);
+// Drops a reference; the last one returns obj to the pool.
+void imu_pool_put(struct imu_pool *p, void *obj);
+
+uint32_t imu_pool_available(const struct imu_pool *p);
+
+// Points fifo->data at a pool buffer and sets fifo->length to its size.
+int imu_pool_get_fifo(struct imu_pool *p, struct bmi08_fifo_frame *fifo);
+void imu_pool_put_fifo(struct imu_pool *p, struct bmi08_fifo_frame *fifo);
+
+void imu_handoff_init(struct imu_handoff *h);
+// Push returns IMU_E_FULL and pop NULL when the ring is full or empty.
+int imu_handoff_push(struct imu_handoff *h, void *obj);
+void *imu_handoff_pop(struct imu_handoff *h);
+
+#endif // IMU_POOL_H
@@ -0,0 +1,188 @@
+#include "imu_power.h"
+#include "bmi08.h"
+#include "imu_clock.h"
+#include "imu_error.h"
+#include "imu_recover.h"
+#include <string.h>
+
+static const char *const state_name[IMU_POWER_STATES] = {"active", "idle"};
+
+void imu_power_init(struct imu_power_gov *g, struct bmi08_dev *dev,
+                    imu_power_status_fn status, uint8_t any_mask,
+                    uint8_t no_mask) {
+  memset(g, 0, sizeof(*g));
+  g->dev = dev;
+  g->status = status;
+  g->any_mask = any_mask;
+  g->no_mask = no_mask;
+  g->mode[IMU_POWER_ACTIVE].accel_odr = dev->accel_cfg.odr;
+  g->mode[IMU_POWER_ACTIVE].accel_bw = dev->accel_cfg.bw;
+  g->mode[IMU_POWER_ACTIVE].gyro_power = BMI08_GYRO_PM_NORMAL;
+  g->mode[IMU_POWER_ACTIVE].gyro_odr = dev->gyro_cfg.odr;
+  g->mode[IMU_POWER_IDLE].accel_odr = BMI08_ACCEL_ODR_50_HZ;
+  g->mode[IMU_POWER_IDLE].accel_bw = dev->accel_cfg.bw;
+  g->mode[IMU_POWER_IDLE].gyro_power = BMI08_GYRO_PM_SUSPEND;
+  g->mode[IMU_POWER_IDLE].gyro_odr = dev->gyro_cfg.odr;
+}
+
+static int8_t write_accel(struct imu_power_gov *g,
+                          const struct imu_power_mode *m, int force) {
+  struct bmi08_dev *dev = g->dev;
+  uint8_t conf;
+  int8_t rslt;
+
+  if (!force && dev->accel_cfg.odr == m->accel_odr &&
+      dev->accel_cfg.bw == m->accel_bw)
+    return BMI08_OK;
+  conf = (uint8_t)(m->accel_bw << 4 | (m->accel_odr & BMI08_ACCEL_ODR_MASK));
+  rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_CONF, &conf, 1, dev, SET_FUNC);
+  if (rslt == BMI08_OK) {
+    dev->accel_cfg.odr = m->accel_odr;
+    dev->accel_cfg.bw = m->accel_bw;
+  }
+  return rslt;
+}
+
+// The bandwidth goes in before the gyro leaves suspend, so it starts up at
+// the requested rate.
+static int8_t write_gyro(struct imu_power_gov *g,
+                         const struct imu_power_mode *m, uint64_t now_ns,
+                         int force) {
+  struct bmi08_dev *dev = g->dev;
+  int8_t rslt = BMI08_OK;
+
+  if (m->gyro_power == BMI08_GYRO_PM_NORMAL &&
+      (force || dev->gyro_cfg.odr != m->gyro_odr)) {
+    rslt = bmi08g_set_regs(BMI08_REG_GYRO_BANDWIDTH, &m->gyro_odr, 1, dev);
+    if (rslt != BMI08_OK)
+      return rslt;
+    dev->gyro_cfg.odr = m->gyro_odr;
+    dev->gyro_cfg.bw = m->gyro_odr;
+  }
+  if (force || dev->gyro_cfg.power != m->gyro_power) {
+    rslt = bmi08g_set_regs(BMI08_REG_GYRO_LPM1, &m->gyro_power, 1, dev);
+    if (rslt != BMI08_OK)
+      return rslt;
+    if (m->gyro_power == BMI08_GYRO_PM_NORMAL &&
+        dev->gyro_cfg.power != BMI08_GYRO_PM_NORMAL)
+      g->gyro_ready_ns = now_ns + IMU_POWER_GYRO_STARTUP_NS;
+    dev->gyro_cfg.power = m->gyro_power;
+  }
+  return rslt;
+}
+
+// Waking raises the accel rate first, the cheaper and more urgent of the
+// two; going idle stops the gyro first.
+static int apply(struct imu_power_gov *g, uint8_t state, uint64_t now_ns,
+                 int force) {
+  const struct imu_power_mode *m = &g->mode[state];
+  int8_t rslt;
+
+  if (state == IMU_POWER_ACTIVE) {
+    rslt = write_accel(g, m, force);
+    if (rslt == BMI08_OK)
+      rslt = write_gyro(g, m, now_ns, force);
+  } else {
+    rslt = write_gyro(g, m, now_ns, force);
+    if (rslt == BMI08_OK)
+      rslt = write_accel(g, m, force);
+  }
+  if (g->recover != NULL)
+    imu_recover_note_conf(g->recover);
+  if (rslt != BMI08_OK) {
+    g->rslt = rslt;
+    return IMU_E_IO;
+  }
+
+  g->state = state;
+  g->entered[state]++;
+  g->idle_pending = 0;
+  return IMU_OK;
+}
+
+static void account(struct imu_power_gov *g, uint64_t now_ns) {
+  if (now_ns > g->last_ns) {
+    g->time_ns[g->state] += now_ns - g->last_ns;
+    g->last_ns = now_ns;
+  }
+}
+
+int imu_power_start(struct imu_power_gov *g, uint64_t now_ns) {
+  if (g == NULL || g->dev == NULL)
+    return IMU_E_NULL_PTR;
+  g->last_ns = now_ns;
+  g->last_motion_ns = now_ns;
+  // The gyro may already be running; only a real wake moves gyro_ready_ns.
+  g->gyro_ready_ns = now_ns;
+  return apply(g, IMU_POWER_ACTIVE, now_ns, 1);
+}
+
+int imu_power_event(struct imu_power_gov *g, uint8_t int_status,
+                    uint64_t now_ns) {
+  uint64_t wake;
+  int r;
+
+  if (g == NULL || g->dev == NULL)
+    return IMU_E_NULL_PTR;
+  account(g, now_ns);
+
+  if (g->state == IMU_POWER_IDLE) {
+    if (!(int_status & g->any_mask))
+      return IMU_OK;
+    r = apply(g, IMU_POWER_ACTIVE, now_ns, 0);
+    if (r != IMU_OK)
+      return r;
+    g->last_motion_ns = now_ns;
+    wake = imu_now_ns();
+    g->last_wake_ns = wake > now_ns ? wake - now_ns : 0;
+    if (g->last_wake_ns > g->max_wake_ns)
+      g->max_wake_ns = g->last_wake_ns;
+    return IMU_POWER_CHANGED;
+  }
+
+  if (int_status & g->any_mask) {
+    g->last_motion_ns = now_ns;
+    g->idle_pending = 0;
+  } else if (int_status & g->no_mask) {
+    g->idle_pending = 1;
+  }
+  // A no-motion that arrived during the hold takes effect once it ends,
+  // on whichever later event or poll comes first.
+  if (!g->idle_pending || now_ns - g->last_motion_ns < g->min_active_ns)
+    return IMU_OK;
+  r = apply(g, IMU_POWER_IDLE, now_ns, 0);
+  return r == IMU_OK ? IMU_POWER_CHANGED : r;
+}
+
+int imu_power_poll(struct imu_power_gov *g, uint64_t now_ns) {
+  uint8_t status = 0;
+  int8_t rslt;
+
+  if (g == NULL || g->status == NULL)
+    return IMU_E_NULL_PTR;
+  rslt = g->status(&status, g->dev);
+  if (rslt != BMI08_OK) {
+    g->rslt = rslt;
+    return IMU_E_IO;
+  }
+  return imu_power_event(g, status, now_ns);
+}
+
+void imu_power_report(const struct imu_power_gov *g, uint64_t now_ns,
+                      FILE *out) {
+  uint64_t t[IMU_POWER_STATES], total = 0;
+
+  for (unsigned s = 0; s < IMU_POWER_STATES; s++) {
+    t[s] = g->time_ns[s];
+    if (s == g->state && now_ns > g->last_ns)
+      t[s] += now_ns - g->last_ns;
+    total += t[s];
+  }
+  fprintf(out, "%-8s %14s %7s %8s\n", "state", "time_ms", "share", "entered");
+  for (unsigned s = 0; s < IMU_POWER_STATES; s++)
+    fprintf(out, "%-8s %14.3f %6.1f%% %8u\n", state_name[s], t[s] / 1e6,
+            total ? 100.0 * (double)t[s] / (double)total : 0.0,
+            g->entered[s]);
+  fprintf(out, "wake latency (us): last %.1f max %.1f\n",
+          g->last_wake_ns / 1e3, g->max_wake_ns / 1e3);
+}
@@ -0,0 +1,83 @@
+#ifndef IMU_POWER_H
+#define IMU_POWER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bmi08_defs.h"
+
+struct imu_recover;
+
+// Activity-adaptive power governor. The accel feature engine's any-motion
+// and no-motion interrupts drive two modes: ACTIVE runs both sensors at
+// full rate, IDLE suspends the gyro and drops the accel to a low ODR that
+// still feeds the any-motion detector. Mode switches are plain register
+// writes without the driver's settle delays, so waking costs two or three
+// bus writes; the gyro needs its start-up time after that, which is
+// reported in gyro_ready_ns instead of slept through.
+
+#define IMU_POWER_ACTIVE 0
+#define IMU_POWER_IDLE 1
+#define IMU_POWER_STATES 2
+
+// Outcome of imu_power_event / imu_power_poll besides the IMU_E_* codes.
+#define IMU_POWER_CHANGED 1
+
+// Gyro start-up after leaving suspend, in ns.
+#define IMU_POWER_GYRO_STARTUP_NS                                              \
+  ((uint64_t)BMI08_GYRO_POWER_MODE_CONFIG_DELAY * 1000000u)
+
+// bmi088_mma_get_feat_int_status and bmi088_anymotion_get_feat_int_status
+// both fit.
+typedef int8_t (*imu_power_status_fn)(uint8_t *int_status,
+                                      struct bmi08_dev *dev);
+
+struct imu_power_mode {
+  uint8_t accel_odr;
+  uint8_t accel_bw;
+  uint8_t gyro_power; // BMI08_GYRO_PM_*
+  uint8_t gyro_odr;   // BMI08_GYRO_BW_*_ODR_*
+};
+
+struct imu_power_gov {
+  struct bmi08_dev *dev;
+  struct imu_recover *recover; // optional, kept in step with each switch
+  imu_power_status_fn status;
+  uint8_t any_mask; // any-motion bit(s) in the feature int status
+  uint8_t no_mask;  // no-motion bit(s)
+  struct imu_power_mode mode[IMU_POWER_STATES];
+  uint64_t min_active_ns; // stay active this long after the last motion
+  int8_t rslt;            // driver code of the last failing call
+
+  uint8_t state;
+  uint8_t idle_pending; // no-motion seen during the hold
+  uint64_t last_ns;
+  uint64_t last_motion_ns;
+  uint64_t gyro_ready_ns; // gyro data is valid from here on
+
+  uint64_t time_ns[IMU_POWER_STATES];
+  uint32_t entered[IMU_POWER_STATES];
+  uint64_t last_wake_ns; // event timestamp to ACTIVE mode written
+  uint64_t max_wake_ns;
+};
+
+// ACTIVE is taken from dev->accel_cfg / dev->gyro_cfg; IDLE defaults to
+// a 50 Hz accel, enough for the any-motion engine, and a suspended gyro.
+void imu_power_init(struct imu_power_gov *g, struct bmi08_dev *dev,
+                    imu_power_status_fn status, uint8_t any_mask,
+                    uint8_t no_mask);
+
+// Writes the ACTIVE mode and starts the state clock at now_ns.
+int imu_power_start(struct imu_power_gov *g, uint64_t now_ns);
+
+// Feeds a feature int status read elsewhere, e.g. in the INT handler;
+// now_ns is when the interrupt fired.
+int imu_power_event(struct imu_power_gov *g, uint8_t int_status,
+                    uint64_t now_ns);
+// Reads the status through g->status, then as imu_power_event.
+int imu_power_poll(struct imu_power_gov *g, uint64_t now_ns);
+
+void imu_power_report(const struct imu_power_gov *g, uint64_t now_ns,
+                      FILE *out);
+
+#endif // IMU_POWER_H
@@ -0,0 +1,201 @@
+#include "imu_psd.h"
+#include "imu_error.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+int imu_psd_init(struct imu_psd *p, unsigned n, unsigned overlap, float fs_hz,
+                 unsigned segments_per_report) {
+  unsigned m = n / 2, bits = 0;
+  double s2 = 0.0;
+
+  if (p == NULL)
+    return IMU_E_NULL_PTR;
+  if (n < 16 || n > IMU_PSD_MAX_N || (n & (n - 1)) != 0 || overlap >= n ||
+      !(fs_hz > 0.0f) || segments_per_report == 0)
+    return IMU_E_INVALID_INPUT;
+
+  memset(p, 0, sizeof(*p));
+  p->n = n;
+  p->hop = n - overlap;
+  p->per_report = segments_per_report;
+  p->fs_hz = fs_hz;
+
+  // Periodic Hann, the Welch default.
+  for (unsigned i = 0; i < n; i++) {
+    double w = 0.5 - 0.5 * cos(2.0 * M_PI * i / n);
+    p->window[i] = (float)w;
+    s2 += w * w;
+  }
+  p->scale = (float)(1.0 / (fs_hz * s2));
+
+  while ((1u << bits) < m)
+    bits++;
+  for (unsigned i = 0; i < m; i++) {
+    unsigned r = 0;
+    for (unsigned b = 0; b < bits; b++)
+      r |= ((i >> b) & 1u) << (bits - 1 - b);
+    p->rev[i] = (uint16_t)r;
+  }
+
+  // The stage with half-size h uses entries h - 1 .. 2h - 2.
+  for (unsigned h = 1; h < m; h *= 2) {
+    for (unsigned j = 0; j < h; j++) {
+      double a = -M_PI * j / h;
+      p->tw_re[h - 1 + j] = (float)cos(a);
+      p->tw_im[h - 1 + j] = (float)sin(a);
+    }
+  }
+  for (unsigned k = 0; k < m; k++) {
+    double a = -2.0 * M_PI * k / n;
+    p->split_re[k] = (float)cos(a);
+    p->split_im[k] = (float)sin(a);
+  }
+  return IMU_OK;
+}
+
+int imu_psd_add_band(struct imu_psd *p, float lo_hz, float hi_hz) {
+  struct imu_psd_band *b;
+  float df;
+
+  if (p == NULL)
+    return IMU_E_NULL_PTR;
+  if (!(lo_hz >= 0.0f) || !(hi_hz > lo_hz))
+    return IMU_E_INVALID_INPUT;
+  if (p->nbands == IMU_PSD_MAX_BANDS)
+    return IMU_E_FULL;
+
+  df = p->fs_hz / (float)p->n;
+  b = &p->band[p->nbands];
+  b->lo_hz = lo_hz;
+  b->hi_hz = hi_hz;
+  b->k0 = (unsigned)ceilf(lo_hz / df);
+  b->k1 = (unsigned)ceilf(hi_hz / df);
+  if (b->k1 > p->n / 2 + 1)
+    b->k1 = p->n / 2 + 1;
+  if (b->k0 > b->k1)
+    b->k0 = b->k1;
+  return (int)p->nbands++;
+}
+
+// Adds the one-sided PSD of one windowed, mean-free segment to acc.
+static void segment_power(const struct imu_psd *p, const float *x,
+                          float *acc) {
+  const unsigned m = p->n / 2;
+  _Alignas(IMU_BLOCK_ALIGN) float re[IMU_PSD_MAX_N / 2];
+  _Alignas(IMU_BLOCK_ALIGN) float im[IMU_PSD_MAX_N / 2];
+  float mean = 0.0f, two = 2.0f * p->scale;
+
+#pragma omp simd reduction(+ : mean)
+  for (unsigned i = 0; i < p->n; i++)
+    mean += x[i];
+  mean /= (float)p->n;
+
+  // Even samples in the real part, odd ones in the imaginary part.
+  for (unsigned i = 0; i < m; i++) {
+    re[p->rev[i]] = (x[2 * i] - mean) * p->window[2 * i];
+    im[p->rev[i]] = (x[2 * i + 1] - mean) * p->window[2 * i + 1];
+  }
+
+  for (unsigned h = 1; h < m; h *= 2) {
+    const float *wr = &p->tw_re[h - 1], *wi = &p->tw_im[h - 1];
+    for (unsigned base = 0; base < m; base += 2 * h) {
+      float *ar = &re[base], *ai = &im[base];
+      float *br = ar + h, *bi = ai + h;
+#pragma omp simd
+      for (unsigned j = 0; j < h; j++) {
+        float tr = br[j] * wr[j] - bi[j] * wi[j];
+        float ti = br[j] * wi[j] + bi[j] * wr[j];
+        br[j] = ar[j] - tr;
+        bi[j] = ai[j] - ti;
+        ar[j] += tr;
+        ai[j] += ti;
+      }
+    }
+  }
+
+  // X[k] = E[k] + W^k O[k] with E, O the spectra of the even and odd
+  // samples; bins 0 and n/2 are real.
+  acc[0] += (re[0] + im[0]) * (re[0] + im[0]) * p->scale;
+  acc[m] += (re[0] - im[0]) * (re[0] - im[0]) * p->scale;
+#pragma omp simd
+  for (unsigned k = 1; k < m; k++) {
+    float zr = re[k], zi = im[k], cr = re[m - k], ci = -im[m - k];
+    float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+    float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+    float xr = er + p->split_re[k] * or_ - p->split_im[k] * oi;
+    float xi = ei + p->split_re[k] * oi + p->split_im[k] * or_;
+    acc[k] += (xr * xr + xi * xi) * two;
+  }
+}
+
+static void publish(struct imu_psd *p) {
+  const unsigned bins = p->n / 2 + 1;
+  const float df = p->fs_hz / (float)p->n;
+  const float inv = 1.0f / (float)p->segments;
+  struct imu_psd_report *r = &p->report;
+
+  for (unsigned a = 0; a < 3; a++) {
+    float total = 0.0f;
+#pragma omp simd reduction(+ : total)
+    for (unsigned k = 0; k < bins; k++) {
+      p->spectrum[a][k] = p->acc[a][k] * inv;
+      total += k > 0 ? p->spectrum[a][k] : 0.0f;
+    }
+    r->total[a] = total * df;
+    for (unsigned i = 0; i < p->nbands; i++) {
+      float e = 0.0f;
+      for (unsigned k = p->band[i].k0; k < p->band[i].k1; k++)
+        e += p->spectrum[a][k];
+      r->energy[a][i] = e * df;
+    }
+    memset(p->acc[a], 0, bins * sizeof(float));
+  }
+  r->t_ns = p->last_t;
+  r->segments = p->segments;
+  r->seq++;
+  p->segments = 0;
+}
+
+int imu_psd_push(struct imu_psd *p, const struct imu_block_f *b) {
+  const float *lane[3];
+  size_t i = 0;
+  int reports = 0;
+
+  if (p == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+  if (p->n == 0)
+    return IMU_E_NOT_READY;
+
+  lane[0] = b->x;
+  lane[1] = b->y;
+  lane[2] = b->z;
+  while (i < b->n) {
+    size_t take = p->n - p->fill;
+
+    if (take > b->n - i)
+      take = b->n - i;
+    for (unsigned a = 0; a < 3; a++)
+      memcpy(&p->buf[a][p->fill], lane[a] + i, take * sizeof(float));
+    p->fill += (unsigned)take;
+    i += take;
+    if (p->fill < p->n)
+      break;
+
+    p->last_t = b->t[i - 1];
+    for (unsigned a = 0; a < 3; a++) {
+      segment_power(p, p->buf[a], p->acc[a]);
+      memmove(p->buf[a], &p->buf[a][p->hop],
+              (p->n - p->hop) * sizeof(float));
+    }
+    p->fill = p->n - p->hop;
+    if (++p->segments == p->per_report) {
+      publish(p);
+      reports++;
+    }
+  }
+  return reports;
+}
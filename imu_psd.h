@@ -0,0 +1,80 @@
+#ifndef IMU_PSD_H
+#define IMU_PSD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Streaming Welch power spectral density over converted or filtered
+// blocks. Samples are cut into Hann-windowed segments of n with the given
+// overlap, each segment's mean is removed, and its power spectrum comes
+// from an n/2 point complex FFT plus a real split. The bit-reversal order
+// and every twiddle are computed once at init, stage by stage so each
+// butterfly pass reads them contiguously. After segments_per_report
+// segments the averaged spectrum and the energy of each configured band
+// are published in p->report.
+
+#define IMU_PSD_MAX_N 1024 // power of two
+#define IMU_PSD_MAX_BINS (IMU_PSD_MAX_N / 2 + 1)
+#define IMU_PSD_MAX_BANDS 16
+
+struct imu_psd_band {
+  float lo_hz;
+  float hi_hz;
+  unsigned k0; // first bin
+  unsigned k1; // one past the last bin
+};
+
+struct imu_psd_report {
+  uint64_t t_ns; // last sample of the last segment
+  uint32_t seq;
+  unsigned segments;
+  float energy[3][IMU_PSD_MAX_BANDS]; // units^2, i.e. variance in band
+  float total[3];                     // all bins but DC
+};
+
+struct imu_psd {
+  unsigned n;
+  unsigned hop;
+  unsigned per_report;
+  float fs_hz;
+  float scale; // 1 / (fs * sum w^2)
+
+  _Alignas(IMU_BLOCK_ALIGN) float window[IMU_PSD_MAX_N];
+  _Alignas(IMU_BLOCK_ALIGN) float tw_re[IMU_PSD_MAX_N / 2]; // per stage
+  _Alignas(IMU_BLOCK_ALIGN) float tw_im[IMU_PSD_MAX_N / 2];
+  _Alignas(IMU_BLOCK_ALIGN) float split_re[IMU_PSD_MAX_N / 2];
+  _Alignas(IMU_BLOCK_ALIGN) float split_im[IMU_PSD_MAX_N / 2];
+  uint16_t rev[IMU_PSD_MAX_N / 2];
+
+  unsigned nbands;
+  struct imu_psd_band band[IMU_PSD_MAX_BANDS];
+
+  unsigned fill;
+  unsigned segments;
+  uint64_t last_t;
+  _Alignas(IMU_BLOCK_ALIGN) float buf[3][IMU_PSD_MAX_N];
+  _Alignas(IMU_BLOCK_ALIGN) float acc[3][IMU_PSD_MAX_BINS];
+  _Alignas(IMU_BLOCK_ALIGN) float spectrum[3][IMU_PSD_MAX_BINS]; // units^2/Hz
+
+  struct imu_psd_report report;
+};
+
+// n is the segment length, overlap how many samples consecutive segments
+// share (n / 2 is the usual choice).
+int imu_psd_init(struct imu_psd *p, unsigned n, unsigned overlap, float fs_hz,
+                 unsigned segments_per_report);
+
+// Returns the band index or a negative IMU_E_* code.
+int imu_psd_add_band(struct imu_psd *p, float lo_hz, float hi_hz);
+
+// Returns how many reports the block completed; p->report and
+// p->spectrum hold the latest.
+int imu_psd_push(struct imu_psd *p, const struct imu_block_f *b);
+
+static inline float imu_psd_bin_hz(const struct imu_psd *p, unsigned k) {
+  return (float)k * p->fs_hz / (float)p->n;
+}
+
+#endif // IMU_PSD_H
@@ -0,0 +1,363 @@
+#include "imu_recover.h"
+#include "bmi08.h"
+#include "imu_clock.h"
+#include "imu_error.h"
+#include <string.h>
+
+void imu_recover_init(struct imu_recover *rc, struct bmi08_dev *dev,
+                      imu_warm_version_fn version) {
+  memset(rc, 0, sizeof(*rc));
+  rc->dev = dev;
+  rc->version = version;
+  rc->accel_chip_id = dev->accel_chip_id;
+  rc->gyro_chip_id = dev->gyro_chip_id;
+}
+
+static int check(struct imu_recover *rc, int8_t rslt) {
+  if (rslt == BMI08_OK)
+    return IMU_OK;
+  rc->rslt = rslt;
+  return IMU_E_IO;
+}
+
+int imu_recover_attach_blob(struct imu_recover *rc) {
+  int8_t rslt = BMI08_OK;
+  int r = imu_warm_attach(rc->dev, rc->version, &rc->warm, &rslt);
+
+  if (r < 0) {
+    rc->rslt = rslt;
+    return r;
+  }
+  rc->have |= IMU_RECOVER_ACCEL_BLOB;
+  return r;
+}
+
+// Range is written directly, as imu_sched does, since bmi08a_set_meas_conf
+// covers only odr and bw.
+static int8_t apply_accel_conf(struct bmi08_dev *dev) {
+  uint8_t range = dev->accel_cfg.range & BMI08_ACCEL_RANGE_MASK;
+  int8_t rslt = bmi08a_set_power_mode(dev);
+
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_set_meas_conf(dev);
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_RANGE, &range, 1, dev,
+                               SET_FUNC);
+  return rslt;
+}
+
+static int8_t apply_gyro_conf(struct bmi08_dev *dev) {
+  int8_t rslt = bmi08g_set_power_mode(dev);
+
+  return rslt == BMI08_OK ? bmi08g_set_meas_conf(dev) : rslt;
+}
+
+int imu_recover_accel_conf(struct imu_recover *rc) {
+  int r = check(rc, apply_accel_conf(rc->dev));
+
+  if (r == IMU_OK) {
+    rc->accel_cfg = rc->dev->accel_cfg;
+    rc->have |= IMU_RECOVER_ACCEL_CONF;
+  }
+  return r;
+}
+
+int imu_recover_gyro_conf(struct imu_recover *rc) {
+  int r = check(rc, apply_gyro_conf(rc->dev));
+
+  if (r == IMU_OK) {
+    rc->gyro_cfg = rc->dev->gyro_cfg;
+    rc->have |= IMU_RECOVER_GYRO_CONF;
+  }
+  return r;
+}
+
+void imu_recover_note_conf(struct imu_recover *rc) {
+  if (rc->have & IMU_RECOVER_ACCEL_CONF)
+    rc->accel_cfg = rc->dev->accel_cfg;
+  if (rc->have & IMU_RECOVER_GYRO_CONF)
+    rc->gyro_cfg = rc->dev->gyro_cfg;
+}
+
+int imu_recover_accel_int(struct imu_recover *rc,
+                          const struct bmi08_accel_int_channel_cfg *cfg) {
+  uint8_t i;
+  int r;
+
+  if (cfg == NULL)
+    return IMU_E_NULL_PTR;
+  for (i = 0; i < rc->accel_ints; i++)
+    if (rc->accel_int[i].int_channel == cfg->int_channel)
+      break;
+  if (i == IMU_RECOVER_MAX_INTS)
+    return IMU_E_FULL;
+
+  r = check(rc, bmi08a_set_int_config(cfg, rc->dev));
+  if (r == IMU_OK) {
+    rc->accel_int[i] = *cfg;
+    if (i == rc->accel_ints)
+      rc->accel_ints++;
+    rc->have |= IMU_RECOVER_ACCEL_INT;
+  }
+  return r;
+}
+
+static const uint8_t gyro_reg_addr[3] = {BMI08_REG_GYRO_INT_CTRL,
+                                         BMI08_REG_GYRO_INT3_INT4_IO_MAP,
+                                         BMI08_REG_GYRO_FIFO_CONFIG1};
+
+// Bits of have that each of gyro_regs belongs to.
+static const uint32_t gyro_reg_item[3] = {
+    IMU_RECOVER_GYRO_INT, IMU_RECOVER_GYRO_INT, IMU_RECOVER_GYRO_FIFO};
+
+static int8_t read_gyro_regs(struct imu_recover *rc, uint8_t regs[3]) {
+  int8_t rslt = BMI08_OK;
+
+  for (unsigned i = 0; i < 3 && rslt == BMI08_OK; i++) {
+    if (rc->have & gyro_reg_item[i])
+      rslt = bmi08g_get_regs(gyro_reg_addr[i], &regs[i], 1, rc->dev);
+  }
+  return rslt;
+}
+
+int imu_recover_gyro_int(struct imu_recover *rc,
+                         const struct bmi08_gyro_int_channel_cfg *cfg) {
+  uint8_t i;
+  int r;
+
+  if (cfg == NULL)
+    return IMU_E_NULL_PTR;
+  for (i = 0; i < rc->gyro_ints; i++)
+    if (rc->gyro_int[i].int_channel == cfg->int_channel)
+      break;
+  if (i == IMU_RECOVER_MAX_INTS)
+    return IMU_E_FULL;
+
+  r = check(rc, bmi08g_set_int_config(cfg, rc->dev));
+  if (r == IMU_OK) {
+    rc->gyro_int[i] = *cfg;
+    if (i == rc->gyro_ints)
+      rc->gyro_ints++;
+    rc->have |= IMU_RECOVER_GYRO_INT;
+    r = check(rc, read_gyro_regs(rc, rc->gyro_regs));
+  }
+  return r;
+}
+
+int imu_recover_accel_fifo(struct imu_recover *rc,
+                           const struct bmi08_accel_fifo_config *cfg,
+                           uint16_t wm) {
+  struct bmi08_accel_fifo_config c;
+  int r;
+
+  if (cfg == NULL)
+    return IMU_E_NULL_PTR;
+  c = *cfg;
+  r = check(rc, bmi08a_get_set_fifo_config(&c, rc->dev, SET_FUNC));
+  if (r == IMU_OK)
+    r = check(rc, bmi08a_get_set_fifo_wm(&wm, rc->dev, SET_FUNC));
+  if (r == IMU_OK) {
+    rc->accel_fifo = *cfg;
+    rc->accel_fifo_wm = wm;
+    rc->have |= IMU_RECOVER_ACCEL_FIFO | IMU_RECOVER_ACCEL_FIFO_WM;
+  }
+  return r;
+}
+
+int imu_recover_gyro_fifo(struct imu_recover *rc,
+                          const struct bmi08_gyr_fifo_config *cfg) {
+  int r;
+
+  if (cfg == NULL)
+    return IMU_E_NULL_PTR;
+  r = check(rc, bmi08g_set_fifo_config(cfg, rc->dev));
+  if (r == IMU_OK) {
+    rc->gyro_fifo = *cfg;
+    rc->have |= IMU_RECOVER_GYRO_FIFO;
+    r = check(rc, read_gyro_regs(rc, rc->gyro_regs));
+  }
+  return r;
+}
+
+// Reads power mode and meas conf back into dev and compares them with the
+// shadow. dev keeps the shadow values afterwards either way.
+static int8_t accel_conf_lost(struct imu_recover *rc, int *lost) {
+  struct bmi08_dev *dev = rc->dev;
+  uint8_t ctrl = 0, want;
+  int8_t rslt = bmi08a_get_power_mode(dev);
+
+  // PWR_CONF alone reads suspend both after a reset and when asked for.
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_PWR_CTRL, &ctrl, 1, dev,
+                               GET_FUNC);
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_get_meas_conf(dev);
+  want = rc->accel_cfg.power == BMI08_ACCEL_PM_ACTIVE
+             ? BMI08_ACCEL_POWER_ENABLE
+             : BMI08_ACCEL_POWER_DISABLE;
+  *lost = ctrl != want || dev->accel_cfg.power != rc->accel_cfg.power ||
+          dev->accel_cfg.odr != rc->accel_cfg.odr ||
+          dev->accel_cfg.bw != rc->accel_cfg.bw ||
+          dev->accel_cfg.range != rc->accel_cfg.range;
+  dev->accel_cfg = rc->accel_cfg;
+  return rslt;
+}
+
+static int8_t gyro_conf_lost(struct imu_recover *rc, int *lost) {
+  struct bmi08_dev *dev = rc->dev;
+  int8_t rslt = bmi08g_get_power_mode(dev);
+
+  if (rslt == BMI08_OK)
+    rslt = bmi08g_get_meas_conf(dev);
+  *lost = dev->gyro_cfg.power != rc->gyro_cfg.power ||
+          dev->gyro_cfg.odr != rc->gyro_cfg.odr ||
+          dev->gyro_cfg.bw != rc->gyro_cfg.bw ||
+          dev->gyro_cfg.range != rc->gyro_cfg.range;
+  dev->gyro_cfg = rc->gyro_cfg;
+  return rslt;
+}
+
+static int8_t gyro_regs_lost(struct imu_recover *rc, int *lost) {
+  uint8_t regs[3] = {0};
+  int8_t rslt = read_gyro_regs(rc, regs);
+
+  for (unsigned i = 0; i < 3; i++) {
+    if ((rc->have & gyro_reg_item[i]) && regs[i] != rc->gyro_regs[i])
+      *lost = 1;
+  }
+  return rslt;
+}
+
+static int recover_accel(struct imu_recover *rc) {
+  struct bmi08_dev *dev = rc->dev;
+  int lost = 1;
+  int r;
+
+  if (!(rc->have & IMU_RECOVER_ACCEL_ITEMS))
+    return IMU_OK;
+
+  r = check(rc, bmi08a_init(dev));
+  if (r != IMU_OK)
+    return r;
+  if (dev->accel_chip_id != rc->accel_chip_id)
+    return IMU_E_NOT_FOUND;
+
+  // Without a shadow of the config registers there is nothing to compare
+  // against, so everything else counts as lost.
+  if (rc->have & IMU_RECOVER_ACCEL_CONF) {
+    r = check(rc, accel_conf_lost(rc, &lost));
+    if (r != IMU_OK)
+      return r;
+  }
+
+  if (rc->have & IMU_RECOVER_ACCEL_BLOB) {
+    // imu_warm reads INTERNAL_STAT and uploads only when the blob is gone.
+    r = imu_recover_attach_blob(rc);
+    if (r < 0)
+      return r;
+    if (r == IMU_WARM_UPLOADED) {
+      rc->uploads++;
+      rc->last_restored |= IMU_RECOVER_ACCEL_BLOB;
+      lost = 1;
+    }
+  }
+  if (!lost)
+    return IMU_OK;
+
+  if (rc->have & IMU_RECOVER_ACCEL_CONF) {
+    r = check(rc, apply_accel_conf(dev));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_ACCEL_CONF;
+  }
+  for (uint8_t i = 0; i < rc->accel_ints; i++) {
+    r = check(rc, bmi08a_set_int_config(&rc->accel_int[i], dev));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_ACCEL_INT;
+  }
+  if (rc->have & IMU_RECOVER_ACCEL_FIFO) {
+    struct bmi08_accel_fifo_config c = rc->accel_fifo;
+    uint16_t wm = rc->accel_fifo_wm;
+
+    r = check(rc, bmi08a_get_set_fifo_config(&c, dev, SET_FUNC));
+    if (r == IMU_OK)
+      r = check(rc, bmi08a_get_set_fifo_wm(&wm, dev, SET_FUNC));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_ACCEL_FIFO | IMU_RECOVER_ACCEL_FIFO_WM;
+  }
+  return IMU_OK;
+}
+
+static int recover_gyro(struct imu_recover *rc) {
+  struct bmi08_dev *dev = rc->dev;
+  int lost = 1;
+  int8_t rslt;
+  int r;
+
+  if (!(rc->have & IMU_RECOVER_GYRO_ITEMS))
+    return IMU_OK;
+
+  rslt = bmi08g_init(dev);
+  if (rslt == BMI08_E_DEV_NOT_FOUND)
+    return IMU_E_NOT_FOUND;
+  r = check(rc, rslt);
+  if (r != IMU_OK)
+    return r;
+
+  if (rc->have & IMU_RECOVER_GYRO_CONF) {
+    r = check(rc, gyro_conf_lost(rc, &lost));
+    if (r != IMU_OK)
+      return r;
+  }
+  if (!lost && (rc->have & (IMU_RECOVER_GYRO_INT | IMU_RECOVER_GYRO_FIFO))) {
+    r = check(rc, gyro_regs_lost(rc, &lost));
+    if (r != IMU_OK)
+      return r;
+  }
+  if (!lost)
+    return IMU_OK;
+
+  if (rc->have & IMU_RECOVER_GYRO_CONF) {
+    r = check(rc, apply_gyro_conf(dev));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_GYRO_CONF;
+  }
+  for (uint8_t i = 0; i < rc->gyro_ints; i++) {
+    r = check(rc, bmi08g_set_int_config(&rc->gyro_int[i], dev));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_GYRO_INT;
+  }
+  if (rc->have & IMU_RECOVER_GYRO_FIFO) {
+    r = check(rc, bmi08g_set_fifo_config(&rc->gyro_fifo, dev));
+    if (r != IMU_OK)
+      return r;
+    rc->last_restored |= IMU_RECOVER_GYRO_FIFO;
+  }
+  return IMU_OK;
+}
+
+int imu_recover_run(struct imu_recover *rc) {
+  uint64_t t0 = imu_now_ns();
+  int r;
+
+  if (rc == NULL || rc->dev == NULL)
+    return IMU_E_NULL_PTR;
+
+  rc->runs++;
+  rc->last_restored = 0;
+  rc->rslt = BMI08_OK;
+  r = recover_accel(rc);
+  if (r == IMU_OK)
+    r = recover_gyro(rc);
+  if (r != IMU_OK)
+    rc->failures++;
+
+  rc->last_ns = imu_now_ns() - t0;
+  if (rc->last_ns > rc->max_ns)
+    rc->max_ns = rc->last_ns;
+  return r;
+}
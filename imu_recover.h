@@ -0,0 +1,97 @@
+#ifndef IMU_RECOVER_H
+#define IMU_RECOVER_H
+
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_warm.h"
+
+// Bus-fault recovery. Configuration applied through the imu_recover_*
+// setters is also kept in a shadow copy. After a BMI08_E_COM_FAIL,
+// imu_recover_run probes both chip ids and reads back power mode and
+// measurement config. Only a sensor that lost its state is reconfigured
+// from the shadow, and the accel config blob goes through imu_warm, so it
+// is not uploaded again while INTERNAL_STAT still reports it loaded. A
+// glitch that reset nothing costs a handful of register reads instead of
+// soft reset, blob upload and the full bring-up.
+
+#define IMU_RECOVER_MAX_INTS 2
+
+// Items kept in the shadow, and restored by the last imu_recover_run.
+#define IMU_RECOVER_ACCEL_BLOB 0x001u
+#define IMU_RECOVER_ACCEL_CONF 0x002u // power mode, odr, bw, range
+#define IMU_RECOVER_ACCEL_INT 0x004u
+#define IMU_RECOVER_ACCEL_FIFO 0x008u
+#define IMU_RECOVER_ACCEL_FIFO_WM 0x010u
+#define IMU_RECOVER_GYRO_CONF 0x020u
+#define IMU_RECOVER_GYRO_INT 0x040u
+#define IMU_RECOVER_GYRO_FIFO 0x080u
+
+// What was lost, as seen by imu_recover_run.
+#define IMU_RECOVER_ACCEL_ITEMS 0x01fu
+#define IMU_RECOVER_GYRO_ITEMS 0x0e0u
+
+struct imu_recover {
+  struct bmi08_dev *dev;
+  imu_warm_version_fn version;
+  struct imu_warm_record warm;
+  uint32_t have; // IMU_RECOVER_* items in the shadow
+  uint8_t accel_chip_id;
+  uint8_t gyro_chip_id;
+  struct bmi08_cfg accel_cfg;
+  struct bmi08_cfg gyro_cfg;
+  struct bmi08_accel_int_channel_cfg accel_int[IMU_RECOVER_MAX_INTS];
+  struct bmi08_gyro_int_channel_cfg gyro_int[IMU_RECOVER_MAX_INTS];
+  uint8_t accel_ints;
+  uint8_t gyro_ints;
+  struct bmi08_accel_fifo_config accel_fifo;
+  uint16_t accel_fifo_wm;
+  struct bmi08_gyr_fifo_config gyro_fifo;
+  // INT_CTRL, INT3_INT4_IO_MAP and FIFO_CONFIG_1 as read back after the
+  // gyro int and FIFO setters. The gyro's reset meas conf equals the
+  // common full-rate config, so these are compared as well.
+  uint8_t gyro_regs[3];
+  int8_t rslt; // driver code of the last failing call
+
+  uint32_t runs;
+  uint32_t failures;     // runs that left the device unrecovered
+  uint32_t uploads;      // runs that had to upload the blob again
+  uint32_t last_restored; // IMU_RECOVER_* items written by the last run
+  uint64_t last_ns;       // duration of the last run
+  uint64_t max_ns;
+};
+
+// Starts with an empty shadow; the chip ids are taken from dev, so call
+// after bmi08xa_init / bmi08g_init.
+void imu_recover_init(struct imu_recover *rc, struct bmi08_dev *dev,
+                      imu_warm_version_fn version);
+
+// Same as imu_warm_attach, and marks the blob as part of the shadow.
+int imu_recover_attach_blob(struct imu_recover *rc);
+
+// Apply dev->accel_cfg / dev->gyro_cfg (power mode, then odr, bw and
+// range).
+int imu_recover_accel_conf(struct imu_recover *rc);
+int imu_recover_gyro_conf(struct imu_recover *rc);
+// Takes dev->accel_cfg / dev->gyro_cfg into the shadow after the caller
+// wrote them some other way (imu_power does).
+void imu_recover_note_conf(struct imu_recover *rc);
+
+// Interrupt channels are kept per channel; setting one twice replaces it.
+int imu_recover_accel_int(struct imu_recover *rc,
+                          const struct bmi08_accel_int_channel_cfg *cfg);
+int imu_recover_gyro_int(struct imu_recover *rc,
+                         const struct bmi08_gyro_int_channel_cfg *cfg);
+
+int imu_recover_accel_fifo(struct imu_recover *rc,
+                           const struct bmi08_accel_fifo_config *cfg,
+                           uint16_t wm);
+int imu_recover_gyro_fifo(struct imu_recover *rc,
+                          const struct bmi08_gyr_fifo_config *cfg);
+
+// Restores what the sensors lost. Returns IMU_OK when both answer with the
+// expected chip id and hold the shadow configuration again, IMU_E_NOT_FOUND
+// when a chip id is wrong, or IMU_E_IO with the driver code in rc->rslt.
+int imu_recover_run(struct imu_recover *rc);
+
+#endif // IMU_RECOVER_H
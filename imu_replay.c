@@ -0,0 +1,409 @@
+#include "imu_replay.h"
+#include "imu_clock.h"
+#include "imu_error.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define HEADER_LEN 8
+#define REPLAY_FAIL ((BMI08_INTF_RET_TYPE)-1)
+
+static size_t put_varint(uint8_t *p, uint64_t v) {
+  size_t n = 0;
+
+  while (v >= 0x80) {
+    p[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  p[n++] = (uint8_t)v;
+  return n;
+}
+
+// Returns 0 when the buffer ends inside the varint.
+static int get_varint(const struct imu_replay *r, size_t *pos, uint64_t *v) {
+  uint64_t out = 0;
+
+  for (unsigned shift = 0; shift < 64 && *pos < r->len; shift += 7) {
+    uint8_t b = r->data[(*pos)++];
+    out |= (uint64_t)(b & 0x7f) << shift;
+    if (!(b & 0x80)) {
+      *v = out;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Recorder */
+
+// Type, time delta and the op specific head; payload follows separately.
+static void rec_head(struct imu_recorder *rec, uint8_t type,
+                     const uint8_t *head, size_t head_len) {
+  uint8_t buf[16];
+  uint64_t now = imu_now_ns();
+  size_t n = 0;
+
+  buf[n++] = type;
+  n += put_varint(&buf[n], now - rec->last_ns);
+  rec->last_ns = now;
+  if (fwrite(buf, 1, n, rec->out) != n ||
+      (head_len > 0 && fwrite(head, 1, head_len, rec->out) != head_len))
+    rec->failed = 1;
+  rec->records++;
+}
+
+static void rec_payload(struct imu_recorder *rec, const void *data,
+                        size_t len) {
+  if (len > 0 && fwrite(data, 1, len, rec->out) != len)
+    rec->failed = 1;
+}
+
+static size_t rw_head(uint8_t *h, uint8_t reg, uint32_t len,
+                      BMI08_INTF_RET_TYPE rslt) {
+  size_t n = 0;
+
+  h[n++] = reg;
+  n += put_varint(&h[n], len);
+  h[n++] = (uint8_t)rslt;
+  return n;
+}
+
+static BMI08_INTF_RET_TYPE rec_read(uint8_t reg_addr, uint8_t *reg_data,
+                                    uint32_t len, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_recorder *rec = port->owner;
+  BMI08_INTF_RET_TYPE rslt = rec->read(reg_addr, reg_data, len, port->intf_ptr);
+  uint8_t h[8];
+
+  rec_head(rec, IMU_REPLAY_READ | port->sensor, h,
+           rw_head(h, reg_addr, len, rslt));
+  rec_payload(rec, reg_data, len);
+  return rslt;
+}
+
+static BMI08_INTF_RET_TYPE rec_write(uint8_t reg_addr, const uint8_t *reg_data,
+                                     uint32_t len, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_recorder *rec = port->owner;
+  BMI08_INTF_RET_TYPE rslt =
+      rec->write(reg_addr, reg_data, len, port->intf_ptr);
+  uint8_t h[8];
+
+  rec_head(rec, IMU_REPLAY_WRITE | port->sensor, h,
+           rw_head(h, reg_addr, len, rslt));
+  rec_payload(rec, reg_data, len);
+  return rslt;
+}
+
+static BMI08_INTF_RET_TYPE rec_write_seq(const struct bmi08_reg_write *seq,
+                                         uint32_t count, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_recorder *rec = port->owner;
+  BMI08_INTF_RET_TYPE rslt = rec->write_seq(seq, count, port->intf_ptr);
+  uint8_t h[8];
+  size_t n = put_varint(h, count);
+
+  h[n++] = (uint8_t)rslt;
+  rec_head(rec, IMU_REPLAY_WRITE_SEQ | port->sensor, h, n);
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t pair[2] = {seq[i].addr, seq[i].data};
+    rec_payload(rec, pair, sizeof(pair));
+  }
+  return rslt;
+}
+
+static void rec_delay_us(uint32_t period, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_recorder *rec = port->owner;
+  uint8_t h[8];
+
+  rec->delay_us(period, port->intf_ptr);
+  rec_head(rec, IMU_REPLAY_DELAY | port->sensor, h, put_varint(h, period));
+}
+
+int imu_recorder_start(struct imu_recorder *rec, struct bmi08_dev *dev,
+                       FILE *out) {
+  uint8_t hdr[HEADER_LEN] = {0};
+  uint32_t magic = IMU_REPLAY_MAGIC;
+  uint16_t version = IMU_REPLAY_VERSION, flags = 0;
+
+  if (rec == NULL || dev == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+
+  if (dev->write_seq != NULL)
+    flags |= IMU_REPLAY_HAS_WRITE_SEQ;
+  memcpy(hdr, &magic, sizeof(magic));
+  memcpy(hdr + 4, &version, 2);
+  memcpy(hdr + 6, &flags, 2);
+  if (fwrite(hdr, 1, sizeof(hdr), out) != sizeof(hdr))
+    return IMU_E_IO;
+
+  rec->dev = dev;
+  rec->out = out;
+  rec->read = dev->read;
+  rec->write = dev->write;
+  rec->write_seq = dev->write_seq;
+  rec->delay_us = dev->delay_us;
+  rec->accel.owner = rec;
+  rec->accel.intf_ptr = dev->intf_ptr_accel;
+  rec->accel.sensor = 0;
+  rec->gyro.owner = rec;
+  rec->gyro.intf_ptr = dev->intf_ptr_gyro;
+  rec->gyro.sensor = IMU_REPLAY_GYRO;
+  rec->last_ns = imu_now_ns();
+  rec->records = 0;
+  rec->failed = 0;
+
+  dev->read = rec_read;
+  dev->write = rec_write;
+  if (dev->write_seq != NULL)
+    dev->write_seq = rec_write_seq;
+  dev->delay_us = rec_delay_us;
+  dev->intf_ptr_accel = &rec->accel;
+  dev->intf_ptr_gyro = &rec->gyro;
+  return IMU_OK;
+}
+
+int imu_recorder_stop(struct imu_recorder *rec) {
+  struct bmi08_dev *dev = rec->dev;
+
+  if (dev == NULL)
+    return IMU_E_NULL_PTR;
+  dev->read = rec->read;
+  dev->write = rec->write;
+  dev->write_seq = rec->write_seq;
+  dev->delay_us = rec->delay_us;
+  dev->intf_ptr_accel = rec->accel.intf_ptr;
+  dev->intf_ptr_gyro = rec->gyro.intf_ptr;
+  rec->dev = NULL;
+  if (fflush(rec->out) != 0)
+    rec->failed = 1;
+  return rec->failed ? IMU_E_IO : IMU_OK;
+}
+
+/* Replayer */
+
+struct record {
+  uint8_t op;
+  uint8_t sensor;
+  uint8_t reg;
+  uint8_t rslt;
+  uint64_t dt;
+  uint64_t arg; // length, pair count or delay
+  const uint8_t *payload;
+  size_t next; // position after the record
+};
+
+static int peek(const struct imu_replay *r, struct record *rc) {
+  size_t pos = r->pos;
+  uint64_t plen = 0;
+  uint8_t type;
+
+  if (pos >= r->len)
+    return 0;
+  type = r->data[pos++];
+  rc->op = type & (uint8_t)~IMU_REPLAY_GYRO;
+  rc->sensor = type & IMU_REPLAY_GYRO;
+  if (!get_varint(r, &pos, &rc->dt))
+    return 0;
+
+  switch (rc->op) {
+  case IMU_REPLAY_READ:
+  case IMU_REPLAY_WRITE:
+    if (pos >= r->len)
+      return 0;
+    rc->reg = r->data[pos++];
+    if (!get_varint(r, &pos, &rc->arg) || pos >= r->len)
+      return 0;
+    plen = rc->arg;
+    break;
+  case IMU_REPLAY_WRITE_SEQ:
+    if (!get_varint(r, &pos, &rc->arg) || pos >= r->len)
+      return 0;
+    plen = rc->arg * 2;
+    break;
+  case IMU_REPLAY_DELAY:
+    if (!get_varint(r, &pos, &rc->arg))
+      return 0;
+    rc->payload = NULL;
+    rc->next = pos;
+    return 1;
+  default:
+    return 0;
+  }
+
+  rc->rslt = r->data[pos++];
+  if (plen > r->len - pos)
+    return 0;
+  rc->payload = &r->data[pos];
+  rc->next = pos + plen;
+  return 1;
+}
+
+static void consume(struct imu_replay *r, const struct record *rc) {
+  r->now_ns += rc->dt;
+  r->pos = rc->next;
+  r->records++;
+}
+
+// The next bus transaction, skipping delays the caller did not replay.
+static int next_bus(struct imu_replay *r, struct record *rc) {
+  while (peek(r, rc)) {
+    if (rc->op != IMU_REPLAY_DELAY)
+      return 1;
+    consume(r, rc);
+  }
+  return 0;
+}
+
+static BMI08_INTF_RET_TYPE mismatch(struct imu_replay *r) {
+  if (r->mismatches++ == 0)
+    r->first_mismatch = r->records;
+  return REPLAY_FAIL;
+}
+
+static BMI08_INTF_RET_TYPE rep_read(uint8_t reg_addr, uint8_t *reg_data,
+                                    uint32_t len, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_replay *r = port->owner;
+  struct record rc;
+
+  if (!next_bus(r, &rc) || rc.op != IMU_REPLAY_READ ||
+      rc.sensor != port->sensor || rc.reg != reg_addr || rc.arg != len) {
+    memset(reg_data, 0, len);
+    return mismatch(r);
+  }
+  memcpy(reg_data, rc.payload, len);
+  consume(r, &rc);
+  return (BMI08_INTF_RET_TYPE)(int8_t)rc.rslt;
+}
+
+static BMI08_INTF_RET_TYPE rep_write(uint8_t reg_addr, const uint8_t *reg_data,
+                                     uint32_t len, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_replay *r = port->owner;
+  struct record rc;
+
+  if (!next_bus(r, &rc) || rc.op != IMU_REPLAY_WRITE ||
+      rc.sensor != port->sensor || rc.reg != reg_addr || rc.arg != len)
+    return mismatch(r);
+  if (memcmp(reg_data, rc.payload, len) != 0)
+    r->write_diffs++;
+  consume(r, &rc);
+  return (BMI08_INTF_RET_TYPE)(int8_t)rc.rslt;
+}
+
+static BMI08_INTF_RET_TYPE rep_write_seq(const struct bmi08_reg_write *seq,
+                                         uint32_t count, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_replay *r = port->owner;
+  struct record rc;
+
+  if (!next_bus(r, &rc) || rc.op != IMU_REPLAY_WRITE_SEQ ||
+      rc.sensor != port->sensor || rc.arg != count)
+    return mismatch(r);
+  for (uint32_t i = 0; i < count; i++) {
+    if (seq[i].addr != rc.payload[2 * i] ||
+        seq[i].data != rc.payload[2 * i + 1]) {
+      r->write_diffs++;
+      break;
+    }
+  }
+  consume(r, &rc);
+  return (BMI08_INTF_RET_TYPE)(int8_t)rc.rslt;
+}
+
+// Never sleeps; only advances the recorded clock.
+static void rep_delay_us(uint32_t period, void *intf_ptr) {
+  struct imu_replay_port *port = intf_ptr;
+  struct imu_replay *r = port->owner;
+  struct record rc;
+
+  (void)period;
+  if (peek(r, &rc) && rc.op == IMU_REPLAY_DELAY)
+    consume(r, &rc);
+}
+
+int imu_replay_init(struct imu_replay *r, const uint8_t *data, size_t len) {
+  uint32_t magic;
+  uint16_t version;
+
+  if (r == NULL || data == NULL)
+    return IMU_E_NULL_PTR;
+  if (len < HEADER_LEN)
+    return IMU_E_FORMAT;
+  memcpy(&magic, data, sizeof(magic));
+  memcpy(&version, data + 4, 2);
+  if (magic != IMU_REPLAY_MAGIC || version != IMU_REPLAY_VERSION)
+    return IMU_E_FORMAT;
+
+  memset(r, 0, sizeof(*r));
+  memcpy(&r->flags, data + 6, 2);
+  r->data = data;
+  r->len = len;
+  r->pos = HEADER_LEN;
+  r->accel.owner = r;
+  r->gyro.owner = r;
+  r->gyro.sensor = IMU_REPLAY_GYRO;
+  return IMU_OK;
+}
+
+int imu_replay_open(struct imu_replay *r, const char *path) {
+  struct stat st;
+  void *p;
+  int fd, rslt;
+
+  if (r == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return IMU_E_IO;
+  if (fstat(fd, &st) != 0 || st.st_size < HEADER_LEN) {
+    close(fd);
+    return IMU_E_FORMAT;
+  }
+  p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return IMU_E_IO;
+
+  rslt = imu_replay_init(r, p, (size_t)st.st_size);
+  if (rslt != IMU_OK) {
+    munmap(p, (size_t)st.st_size);
+    return rslt;
+  }
+  r->map_len = (size_t)st.st_size;
+  return IMU_OK;
+}
+
+void imu_replay_close(struct imu_replay *r) {
+  if (r->map_len != 0)
+    munmap((void *)r->data, r->map_len);
+  r->data = NULL;
+  r->len = 0;
+  r->map_len = 0;
+}
+
+void imu_replay_rewind(struct imu_replay *r) {
+  r->pos = HEADER_LEN;
+  r->now_ns = 0;
+  r->records = 0;
+  r->write_diffs = 0;
+  r->mismatches = 0;
+  r->first_mismatch = 0;
+}
+
+void imu_replay_attach(struct imu_replay *r, struct bmi08_dev *dev) {
+  dev->read = rep_read;
+  dev->write = rep_write;
+  dev->write_seq =
+      (r->flags & IMU_REPLAY_HAS_WRITE_SEQ) ? rep_write_seq : NULL;
+  dev->delay_us = rep_delay_us;
+  dev->intf_ptr_accel = &r->accel;
+  dev->intf_ptr_gyro = &r->gyro;
+}
+
+int imu_replay_done(const struct imu_replay *r) { return r->pos >= r->len; }
@@ -0,0 +1,96 @@
+#ifndef IMU_REPLAY_H
+#define IMU_REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bmi08_defs.h"
+
+// Transport record/replay. The recorder wraps the bmi08_dev hooks like
+// imu_trace does and logs every read, write, write sequence and delay
+// with its payload and timestamp to a compact binary trace. The replayer
+// installs hooks that serve the recorded read data back and check the
+// writes against the trace, so a bmi08a_read_fifo_data /
+// bmi08a_extract_accel session re-runs without hardware and without
+// sleeping.
+//
+// Trace: "IMUR", u16 version, u16 flags, then records of
+//   u8 type | 0x80 for gyro, varint ns since the previous record, and
+//   read/write:  u8 reg, varint len, u8 result, len payload bytes
+//   write seq:   varint count, u8 result, count (reg, value) pairs
+//   delay:       varint us
+// IMU_REPLAY_HAS_WRITE_SEQ in flags says the recorded device had a
+// write_seq hook. Without it the driver falls back to single writes, so
+// the replayer leaves write_seq unset to make the driver do the same.
+
+#define IMU_REPLAY_MAGIC 0x524d5549u // "IMUR"
+#define IMU_REPLAY_VERSION 1u
+
+enum imu_replay_op {
+  IMU_REPLAY_READ = 1,
+  IMU_REPLAY_WRITE = 2,
+  IMU_REPLAY_WRITE_SEQ = 3,
+  IMU_REPLAY_DELAY = 4,
+};
+
+#define IMU_REPLAY_GYRO 0x80u
+#define IMU_REPLAY_HAS_WRITE_SEQ 0x01u
+
+// Handed to the hooks as intf_ptr, one per sensor.
+struct imu_replay_port {
+  void *owner;
+  void *intf_ptr;
+  uint8_t sensor; // 0 or IMU_REPLAY_GYRO
+};
+
+struct imu_recorder {
+  struct bmi08_dev *dev;
+  FILE *out;
+  bmi08_read_fptr_t read;
+  bmi08_write_fptr_t write;
+  bmi08_write_seq_fptr_t write_seq;
+  bmi08_delay_us_fptr_t delay_us;
+  struct imu_replay_port accel;
+  struct imu_replay_port gyro;
+  uint64_t last_ns;
+  uint64_t records;
+  int failed;
+};
+
+struct imu_replay {
+  const uint8_t *data;
+  size_t len;
+  size_t pos;
+  size_t map_len; // nonzero when data was mapped by imu_replay_open
+  uint16_t flags;  // from the trace header
+  struct imu_replay_port accel;
+  struct imu_replay_port gyro;
+  uint64_t now_ns; // recorded time of the last record served
+  uint64_t records;
+  uint64_t write_diffs; // writes whose payload differs from the trace
+  uint64_t mismatches;  // transactions the trace could not serve
+  uint64_t first_mismatch; // record number, valid when mismatches > 0
+};
+
+// Writes the trace header and swaps dev's hooks for recording wrappers.
+int imu_recorder_start(struct imu_recorder *rec, struct bmi08_dev *dev,
+                       FILE *out);
+// Restores the hooks. Returns IMU_E_IO when any record failed to write.
+int imu_recorder_stop(struct imu_recorder *rec);
+
+// Replays a trace held in memory, or mapped from path.
+int imu_replay_init(struct imu_replay *r, const uint8_t *data, size_t len);
+int imu_replay_open(struct imu_replay *r, const char *path);
+void imu_replay_close(struct imu_replay *r);
+// Starts over from the first record and clears the counters.
+void imu_replay_rewind(struct imu_replay *r);
+
+// Points dev's hooks at the replayer; the bus hooks previously installed
+// are not kept. write_seq is only set when the trace was recorded with one.
+void imu_replay_attach(struct imu_replay *r, struct bmi08_dev *dev);
+
+// 1 once every record has been served.
+int imu_replay_done(const struct imu_replay *r);
+
+#endif // IMU_REPLAY_H
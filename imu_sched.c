@@ -0,0 +1,298 @@
+#include "imu_sched.h"
+#include "bmi08.h"
+#include "imu_clock.h"
+#include "imu_error.h"
+#include <string.h>
+#include <time.h>
+
+// The sequence whose step is running; steps never nest, so one is enough.
+static struct imu_seq *active;
+
+static void defer_delay(uint32_t period, void *intf_ptr) {
+  (void)intf_ptr;
+  active->wait_us += period;
+}
+
+static void default_sleep_until(uint64_t ns) {
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)(ns / 1000000000u);
+  ts.tv_nsec = (long)(ns % 1000000000u);
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+void imu_sched_init(struct imu_sched *s) {
+  memset(s, 0, sizeof(*s));
+  s->now = imu_now_ns;
+  s->sleep_until = default_sleep_until;
+}
+
+int imu_sched_add(struct imu_sched *s, struct imu_seq *seq) {
+  if (s == NULL || seq == NULL || seq->dev == NULL)
+    return IMU_E_NULL_PTR;
+  if (s->count == IMU_SCHED_MAX_SEQS)
+    return IMU_E_FULL;
+  seq->pc = 0;
+  seq->index = 0;
+  seq->phase = 0;
+  seq->not_before = 0;
+  seq->rslt = BMI08_OK;
+  s->seqs[s->count++] = seq;
+  return IMU_OK;
+}
+
+static int seq_done(const struct imu_seq *seq) {
+  return seq->pc == seq->nsteps || seq->rslt != BMI08_OK;
+}
+
+static int8_t run_step(struct imu_sched *s, struct imu_seq *seq,
+                       uint64_t now) {
+  bmi08_delay_us_fptr_t delay_us = seq->dev->delay_us;
+  int8_t rslt;
+
+  active = seq;
+  seq->wait_us = 0;
+  seq->dev->delay_us = defer_delay;
+  rslt = seq->steps[seq->pc](seq);
+  seq->dev->delay_us = delay_us;
+  active = NULL;
+
+  s->steps_run++;
+  s->blocking_us += seq->wait_us;
+  seq->not_before = now + (uint64_t)seq->wait_us * 1000u;
+  return rslt;
+}
+
+int imu_sched_run(struct imu_sched *s) {
+  int failed = 0;
+
+  if (s == NULL)
+    return IMU_E_NULL_PTR;
+
+  s->start = s->now();
+  for (;;) {
+    struct imu_seq *next = NULL;
+    uint64_t now;
+    int8_t rslt;
+
+    // Earliest deadline first; ties go to the sequence added first.
+    for (unsigned i = 0; i < s->count; i++) {
+      struct imu_seq *seq = s->seqs[i];
+      if (!seq_done(seq) &&
+          (next == NULL || seq->not_before < next->not_before))
+        next = seq;
+    }
+    if (next == NULL)
+      break;
+
+    now = s->now();
+    if (next->not_before > now) {
+      s->sleep_until(next->not_before);
+      now = s->now();
+    }
+
+    rslt = run_step(s, next, now);
+    if (rslt == BMI08_OK) {
+      next->pc++;
+      next->index = 0;
+      next->phase = 0;
+    } else if (rslt != IMU_SEQ_AGAIN) {
+      next->rslt = rslt;
+      failed = 1;
+    }
+    if (seq_done(next))
+      next->done_at = next->not_before;
+  }
+
+  // The last deadline of each sequence still has to pass before the
+  // device is usable.
+  for (unsigned i = 0; i < s->count; i++) {
+    uint64_t now = s->now();
+    if (s->seqs[i]->done_at > now)
+      s->sleep_until(s->seqs[i]->done_at);
+  }
+  s->elapsed = s->now() - s->start;
+  return failed ? IMU_E_IO : IMU_OK;
+}
+
+void imu_seq_init(struct imu_seq *seq, const char *name,
+                  struct bmi08_dev *dev) {
+  memset(seq, 0, sizeof(*seq));
+  seq->name = name;
+  seq->dev = dev;
+}
+
+int imu_seq_append(struct imu_seq *seq, imu_seq_step_fn step) {
+  if (seq == NULL || step == NULL)
+    return IMU_E_NULL_PTR;
+  if (seq->nsteps == IMU_SEQ_MAX_STEPS)
+    return IMU_E_FULL;
+  seq->steps[seq->nsteps++] = step;
+  return IMU_OK;
+}
+
+static int8_t accel_write(struct bmi08_dev *dev, uint8_t reg, uint8_t val) {
+  return bmi08a_get_set_regs(reg, &val, 1, dev, SET_FUNC);
+}
+
+// bmi08a_soft_reset sleeps before its dummy read, so it is split in two.
+// The power state is unknown until the reset lands; assume the slow one.
+static int8_t accel_reset(struct imu_seq *seq) {
+  int8_t rslt;
+
+  seq->dev->accel_cfg.power = BMI08_ACCEL_PM_SUSPEND;
+  rslt = accel_write(seq->dev, BMI08_REG_ACCEL_SOFTRESET,
+                     BMI08_SOFT_RESET_CMD);
+  seq->wait_us += BMI08_MS_TO_US(BMI08_ACCEL_SOFTRESET_DELAY_MS);
+  return rslt;
+}
+
+static int8_t accel_chip_id(struct imu_seq *seq) {
+  return bmi08a_init(seq->dev);
+}
+
+static int8_t accel_aps_off(struct imu_seq *seq) {
+  int8_t rslt = accel_write(seq->dev, BMI08_REG_ACCEL_PWR_CONF,
+                            BMI08_DISABLE);
+
+  seq->wait_us += 450;
+  return rslt;
+}
+
+static int8_t accel_config_begin(struct imu_seq *seq) {
+  int8_t rslt = bmi08a_config_stream_init(&seq->stream, seq->dev);
+
+  if (rslt == BMI08_OK)
+    rslt = accel_write(seq->dev, BMI08_REG_ACCEL_INIT_CTRL, BMI08_DISABLE);
+  return rslt;
+}
+
+// One register write per call, three per burst, addressed through the
+// same 5B/5C index registers the driver's stream_transfer_write uses.
+// Writes in suspend must be 450 us apart, so each gets its own step. The
+// blob is unpacked one burst at a time, as bmi08a_load_config_file does.
+static int8_t accel_config_burst(struct imu_seq *seq) {
+  struct bmi08_dev *dev = seq->dev;
+  uint32_t index = seq->index;
+  uint32_t len = dev->read_write_len;
+  uint8_t burst[BMI08_CONFIG_BURST_MAX];
+  uint8_t val;
+  int8_t rslt;
+
+  if (len == 0)
+    return BMI08_E_RD_WR_LENGTH_INVALID;
+  if (len > BMI08_CONFIG_BURST_MAX)
+    len = BMI08_CONFIG_BURST_MAX;
+  if (len > BMI08_CONFIG_STREAM_SIZE - index)
+    len = BMI08_CONFIG_STREAM_SIZE - index;
+
+  switch (seq->phase) {
+  case 0:
+    val = (uint8_t)((index / 2) & 0x0F);
+    rslt = accel_write(dev, BMI08_REG_ACCEL_RESERVED_5B, val);
+    break;
+  case 1:
+    val = (uint8_t)((index / 2) >> 4);
+    rslt = accel_write(dev, BMI08_REG_ACCEL_RESERVED_5C, val);
+    break;
+  default:
+    rslt = bmi08a_config_stream_read(&seq->stream, burst, (uint16_t)len);
+    if (rslt == BMI08_OK)
+      rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_FEATURE_CFG, burst, len, dev,
+                                 SET_FUNC);
+    index += len;
+    break;
+  }
+  if (rslt != BMI08_OK)
+    return rslt;
+
+  seq->phase = (seq->phase + 1) % 3;
+  seq->index = index;
+  return seq->index < BMI08_CONFIG_STREAM_SIZE ? IMU_SEQ_AGAIN : BMI08_OK;
+}
+
+static int8_t accel_config_end(struct imu_seq *seq) {
+  int8_t rslt = accel_write(seq->dev, BMI08_REG_ACCEL_INIT_CTRL,
+                            BMI08_ENABLE);
+
+  seq->wait_us += BMI08_MS_TO_US(BMI08_ASIC_INIT_TIME_MS);
+  return rslt;
+}
+
+static int8_t accel_config_check(struct imu_seq *seq) {
+  uint8_t stat = 0;
+  int8_t rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_INTERNAL_STAT, &stat, 1,
+                                    seq->dev, GET_FUNC);
+
+  if (rslt == BMI08_OK && stat != BMI08_INIT_OK)
+    rslt = BMI08_E_CONFIG_STREAM_ERROR;
+  return rslt;
+}
+
+// bmi08a_set_power_mode sleeps between its two writes, so it is split too.
+static int8_t accel_power_conf(struct imu_seq *seq) {
+  int8_t rslt = accel_write(seq->dev, BMI08_REG_ACCEL_PWR_CONF,
+                            BMI08_ACCEL_PM_ACTIVE);
+
+  seq->dev->accel_cfg.power = BMI08_ACCEL_PM_ACTIVE;
+  seq->wait_us += BMI08_MS_TO_US(BMI08_POWER_CONFIG_DELAY);
+  return rslt;
+}
+
+static int8_t accel_power_ctrl(struct imu_seq *seq) {
+  int8_t rslt = accel_write(seq->dev, BMI08_REG_ACCEL_PWR_CTRL,
+                            BMI08_ACCEL_POWER_ENABLE);
+
+  seq->wait_us += BMI08_MS_TO_US(BMI08_POWER_CONFIG_DELAY);
+  return rslt;
+}
+
+static int8_t accel_range(struct imu_seq *seq) {
+  return accel_write(seq->dev, BMI08_REG_ACCEL_RANGE,
+                     seq->dev->accel_cfg.range & BMI08_ACCEL_RANGE_MASK);
+}
+
+static int8_t accel_meas_conf(struct imu_seq *seq) {
+  return bmi08a_set_meas_conf(seq->dev);
+}
+
+void imu_seq_accel_bringup(struct imu_seq *seq, struct bmi08_dev *dev) {
+  imu_seq_init(seq, "accel", dev);
+  imu_seq_append(seq, accel_reset);
+  imu_seq_append(seq, accel_chip_id);
+  if (dev->config_file_ptr != NULL) {
+    imu_seq_append(seq, accel_aps_off);
+    imu_seq_append(seq, accel_config_begin);
+    imu_seq_append(seq, accel_config_burst);
+    imu_seq_append(seq, accel_config_end);
+    imu_seq_append(seq, accel_config_check);
+  }
+  imu_seq_append(seq, accel_power_conf);
+  imu_seq_append(seq, accel_power_ctrl);
+  imu_seq_append(seq, accel_range);
+  imu_seq_append(seq, accel_meas_conf);
+}
+
+static int8_t gyro_reset(struct imu_seq *seq) {
+  return bmi08g_soft_reset(seq->dev);
+}
+
+static int8_t gyro_chip_id(struct imu_seq *seq) {
+  return bmi08g_init(seq->dev);
+}
+
+static int8_t gyro_power(struct imu_seq *seq) {
+  return bmi08g_set_power_mode(seq->dev);
+}
+
+static int8_t gyro_meas_conf(struct imu_seq *seq) {
+  return bmi08g_set_meas_conf(seq->dev);
+}
+
+void imu_seq_gyro_bringup(struct imu_seq *seq, struct bmi08_dev *dev) {
+  imu_seq_init(seq, "gyro", dev);
+  imu_seq_append(seq, gyro_reset);
+  imu_seq_append(seq, gyro_chip_id);
+  imu_seq_append(seq, gyro_power);
+  imu_seq_append(seq, gyro_meas_conf);
+}
@@ -0,0 +1,75 @@
+#ifndef IMU_SCHED_H
+#define IMU_SCHED_H
+
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+
+// Cooperative bring-up scheduler. Initialisation is split into resumable
+// steps; instead of sleeping, a step leaves a "not before" deadline and the
+// scheduler runs whichever other sequence is ready in the meantime, so the
+// 150 ms ASIC init of one accel overlaps the gyro resets, other devices'
+// config uploads and so on.
+
+#define IMU_SCHED_MAX_SEQS 16
+#define IMU_SEQ_MAX_STEPS 16
+
+// Returned by a step that wants to run again, e.g. one config burst at a
+// time so other sequences can interleave between bursts.
+#define IMU_SEQ_AGAIN 1
+
+struct imu_seq;
+
+// A step issues non-blocking register I/O and returns BMI08_OK to advance,
+// IMU_SEQ_AGAIN to repeat or a negative BMI08_E_* code to abort. Delays the
+// driver asks for while a step runs are not slept; they accumulate into
+// wait_us and become the deadline of the next step. A step must therefore
+// end with the only delay it needs: driver APIs that sleep between two bus
+// accesses, or several writes to a suspended accel, are split up.
+typedef int8_t (*imu_seq_step_fn)(struct imu_seq *seq);
+
+struct imu_seq {
+  const char *name;
+  struct bmi08_dev *dev;
+  imu_seq_step_fn steps[IMU_SEQ_MAX_STEPS];
+  unsigned nsteps;
+  unsigned pc;
+  uint32_t index; // scratch for repeating steps, cleared on advance
+  unsigned phase;
+  struct bmi08_config_stream stream;
+  uint32_t wait_us;
+  uint64_t not_before;
+  uint64_t done_at;
+  int8_t rslt;
+};
+
+struct imu_sched {
+  unsigned count;
+  struct imu_seq *seqs[IMU_SCHED_MAX_SEQS];
+  uint64_t (*now)(void);
+  void (*sleep_until)(uint64_t ns);
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t blocking_us; // sum of all deadlines, i.e. the sequential cost
+  uint32_t steps_run;
+};
+
+// now/sleep_until default to the monotonic clock and nanosleep.
+void imu_sched_init(struct imu_sched *s);
+int imu_sched_add(struct imu_sched *s, struct imu_seq *seq);
+
+// Runs every sequence to completion. Returns IMU_OK, or IMU_E_IO when any
+// sequence failed; the driver code is left in that sequence's rslt.
+int imu_sched_run(struct imu_sched *s);
+
+void imu_seq_init(struct imu_seq *seq, const char *name,
+                  struct bmi08_dev *dev);
+int imu_seq_append(struct imu_seq *seq, imu_seq_step_fn step);
+
+// Standard bring-up, mirroring the blocking driver calls: soft reset, chip
+// id, config upload when dev->config_file_ptr is set, power on and the
+// measurement config already held in dev->accel_cfg / dev->gyro_cfg.
+void imu_seq_accel_bringup(struct imu_seq *seq, struct bmi08_dev *dev);
+void imu_seq_gyro_bringup(struct imu_seq *seq, struct bmi08_dev *dev);
+
+#endif // IMU_SCHED_H
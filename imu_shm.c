@@ -0,0 +1,260 @@
+#define _GNU_SOURCE
+#include "imu_shm.h"
+#include "imu_error.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static size_t map_size(uint32_t slot_count) {
+  return sizeof(struct imu_shm_header) +
+         (size_t)slot_count * sizeof(struct imu_shm_slot);
+}
+
+static int map(struct imu_shm *s, int prot) {
+  void *p = mmap(NULL, s->map_size, prot, MAP_SHARED, s->fd, 0);
+
+  if (p == MAP_FAILED)
+    return IMU_E_IO;
+  s->hdr = p;
+  s->slots = (struct imu_shm_slot *)((uint8_t *)p + sizeof(*s->hdr));
+  return IMU_OK;
+}
+
+int imu_shm_create(struct imu_shm *s, const char *name, uint32_t slot_count) {
+  if (s == NULL)
+    return IMU_E_NULL_PTR;
+  if (slot_count == 0 || slot_count > IMU_SHM_MAX_SLOTS ||
+      (slot_count & (slot_count - 1)) != 0)
+    return IMU_E_INVALID_INPUT;
+
+  memset(s, 0, sizeof(*s));
+  s->fd = name != NULL ? shm_open(name, O_CREAT | O_RDWR | O_TRUNC, 0644)
+                       : memfd_create("imu_shm", MFD_CLOEXEC);
+  if (s->fd < 0)
+    return IMU_E_IO;
+
+  s->map_size = map_size(slot_count);
+  if (ftruncate(s->fd, (off_t)s->map_size) != 0 ||
+      map(s, PROT_READ | PROT_WRITE) != IMU_OK) {
+    close(s->fd);
+    s->fd = -1;
+    return IMU_E_IO;
+  }
+
+  // ftruncate zero-fills, so every slot starts at sequence 0 (never
+  // published) and head at 0.
+  s->hdr->slot_count = slot_count;
+  s->hdr->slot_size = sizeof(struct imu_shm_slot);
+  s->hdr->version = IMU_SHM_VERSION;
+  atomic_store_explicit(&s->hdr->head, 0, memory_order_relaxed);
+  // Readers check the magic last.
+  atomic_thread_fence(memory_order_release);
+  s->hdr->magic = IMU_SHM_MAGIC;
+  return IMU_OK;
+}
+
+int imu_shm_open(struct imu_shm *s, const char *name, int fd) {
+  struct imu_shm_header *h;
+  struct stat st;
+
+  if (s == NULL || (fd < 0 && name == NULL))
+    return IMU_E_NULL_PTR;
+
+  memset(s, 0, sizeof(*s));
+  s->fd = fd >= 0 ? fd : shm_open(name, O_RDONLY, 0);
+  if (s->fd < 0)
+    return IMU_E_IO;
+  if (fstat(s->fd, &st) != 0 || (size_t)st.st_size < sizeof(*h)) {
+    imu_shm_close(s);
+    return IMU_E_FORMAT;
+  }
+
+  s->map_size = (size_t)st.st_size;
+  if (map(s, PROT_READ) != IMU_OK) {
+    imu_shm_close(s);
+    return IMU_E_IO;
+  }
+  h = s->hdr;
+  if (h->magic != IMU_SHM_MAGIC || h->version != IMU_SHM_VERSION ||
+      h->slot_size != sizeof(struct imu_shm_slot) ||
+      h->slot_count == 0 || h->slot_count > IMU_SHM_MAX_SLOTS ||
+      map_size(h->slot_count) > s->map_size) {
+    imu_shm_close(s);
+    return IMU_E_FORMAT;
+  }
+  return IMU_OK;
+}
+
+void imu_shm_close(struct imu_shm *s) {
+  if (s->hdr != NULL)
+    munmap(s->hdr, s->map_size);
+  if (s->fd >= 0)
+    close(s->fd);
+  s->hdr = NULL;
+  s->slots = NULL;
+  s->fd = -1;
+}
+
+int imu_shm_unlink(const char *name) {
+  return shm_unlink(name) == 0 ? IMU_OK : IMU_E_IO;
+}
+
+static struct imu_shm_slot *slot_at(const struct imu_shm *s, uint64_t seq) {
+  return &s->slots[seq & (s->hdr->slot_count - 1)];
+}
+
+struct imu_block *imu_shm_claim(struct imu_shm *s, uint32_t device,
+                                enum imu_shm_kind kind) {
+  struct imu_shm_slot *slot;
+  uint64_t n;
+
+  if (s == NULL || s->hdr == NULL)
+    return NULL;
+
+  n = atomic_load_explicit(&s->hdr->head, memory_order_relaxed) + 1;
+  slot = slot_at(s, n);
+  atomic_store_explicit(&slot->seq, 2 * n - 1, memory_order_relaxed);
+  // Orders the odd sequence before the payload stores below.
+  atomic_thread_fence(memory_order_release);
+  slot->device = device;
+  slot->kind = (uint32_t)kind;
+  s->claimed = n;
+  return &slot->block;
+}
+
+void imu_shm_publish(struct imu_shm *s) {
+  uint64_t n = s->claimed;
+
+  if (n == 0)
+    return;
+  atomic_store_explicit(&slot_at(s, n)->seq, 2 * n, memory_order_release);
+  atomic_store_explicit(&s->hdr->head, n, memory_order_release);
+  s->claimed = 0;
+}
+
+static void copy_block(struct imu_block *dst, const struct imu_block *src,
+                       size_t n) {
+  memcpy(dst->x, src->x, n * sizeof(int16_t));
+  memcpy(dst->y, src->y, n * sizeof(int16_t));
+  memcpy(dst->z, src->z, n * sizeof(int16_t));
+  memcpy(dst->t, src->t, n * sizeof(uint64_t));
+  dst->n = n;
+}
+
+int imu_shm_write(struct imu_shm *s, uint32_t device, enum imu_shm_kind kind,
+                  const struct imu_block *b) {
+  struct imu_block *dst;
+
+  if (b == NULL)
+    return IMU_E_NULL_PTR;
+  dst = imu_shm_claim(s, device, kind);
+  if (dst == NULL)
+    return IMU_E_NULL_PTR;
+  copy_block(dst, b, b->n <= IMU_BLOCK_CAP ? b->n : IMU_BLOCK_CAP);
+  imu_shm_publish(s);
+  return IMU_OK;
+}
+
+static uint64_t load_head(const struct imu_shm *s) {
+  return atomic_load_explicit((_Atomic uint64_t *)&s->hdr->head,
+                              memory_order_acquire);
+}
+
+static uint64_t load_seq(const struct imu_shm_slot *slot,
+                         memory_order order) {
+  return atomic_load_explicit((_Atomic uint64_t *)&slot->seq, order);
+}
+
+void imu_shm_reader_init(struct imu_shm_reader *r, const struct imu_shm *s) {
+  uint64_t head = load_head(s);
+  uint32_t count = s->hdr->slot_count;
+
+  r->shm = s;
+  r->next = head >= count ? head - count + 1 : 1;
+  r->lost = 0;
+}
+
+void imu_shm_reader_tail(struct imu_shm_reader *r) {
+  r->next = load_head(r->shm) + 1;
+}
+
+// Positions r->next on a block that is still in the ring; returns 0 when
+// nothing new has been published.
+static int reader_catch_up(struct imu_shm_reader *r) {
+  uint64_t head = load_head(r->shm);
+  uint32_t count = r->shm->hdr->slot_count;
+
+  if (r->next > head)
+    return 0;
+  if (head - r->next >= count) {
+    r->lost += head - count + 1 - r->next;
+    r->next = head - count + 1;
+  }
+  return 1;
+}
+
+int imu_shm_read(struct imu_shm_reader *r, struct imu_block *out,
+                 uint32_t *device, enum imu_shm_kind *kind) {
+  const struct imu_shm_slot *slot;
+  uint64_t s1, s2;
+  uint32_t dev, knd;
+  size_t n;
+
+  if (r == NULL || out == NULL)
+    return IMU_E_NULL_PTR;
+  if (!reader_catch_up(r))
+    return IMU_E_NOT_READY;
+
+  slot = slot_at(r->shm, r->next);
+  s1 = load_seq(slot, memory_order_acquire);
+  if (s1 == 2 * r->next) {
+    n = slot->block.n <= IMU_BLOCK_CAP ? slot->block.n : IMU_BLOCK_CAP;
+    copy_block(out, &slot->block, n);
+    dev = slot->device;
+    knd = slot->kind;
+    // The payload loads above must complete before the recheck.
+    atomic_thread_fence(memory_order_acquire);
+    s2 = load_seq(slot, memory_order_relaxed);
+    if (s2 == s1) {
+      r->next++;
+      if (device != NULL)
+        *device = dev;
+      if (kind != NULL)
+        *kind = (enum imu_shm_kind)knd;
+      return IMU_OK;
+    }
+  }
+  r->lost++;
+  r->next++;
+  return IMU_SHM_LAPPED;
+}
+
+const struct imu_shm_slot *imu_shm_acquire(struct imu_shm_reader *r) {
+  const struct imu_shm_slot *slot;
+
+  if (r == NULL)
+    return NULL;
+  while (reader_catch_up(r)) {
+    slot = slot_at(r->shm, r->next);
+    if (load_seq(slot, memory_order_acquire) == 2 * r->next)
+      return slot;
+    r->lost++;
+    r->next++;
+  }
+  return NULL;
+}
+
+int imu_shm_release(struct imu_shm_reader *r,
+                    const struct imu_shm_slot *slot) {
+  uint64_t expect = 2 * r->next;
+
+  atomic_thread_fence(memory_order_acquire);
+  r->next++;
+  if (load_seq(slot, memory_order_relaxed) != expect) {
+    r->lost++;
+    return IMU_SHM_LAPPED;
+  }
+  return IMU_OK;
+}
@@ -0,0 +1,89 @@
+#ifndef IMU_SHM_H
+#define IMU_SHM_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Shared-memory block bus. The acquisition process publishes imu_block
+// samples into a ring mapped from POSIX shm or a memfd; logger, fusion and
+// telemetry processes map the same ring and read it without locks or
+// syscalls. Every slot is a seqlock: the writer makes its sequence odd,
+// fills the slot and makes it even again, and a reader that sees the
+// sequence change under it knows the slot was overwritten. One writer,
+// any number of readers; a reader that falls a full ring behind skips
+// ahead and counts what it lost.
+
+#define IMU_SHM_MAGIC 0x4d485349u // "ISHM"
+#define IMU_SHM_VERSION 1u
+#define IMU_SHM_MAX_SLOTS 1024 // power of two
+
+// Outcomes of imu_shm_read / imu_shm_release besides the IMU_E_* codes.
+#define IMU_SHM_LAPPED 1 // the slot was overwritten, try the next one
+
+enum imu_shm_kind { IMU_SHM_ACCEL, IMU_SHM_GYRO };
+
+struct imu_shm_slot {
+  _Atomic uint64_t seq; // 2 * n when block n is complete, odd while written
+  uint32_t device;
+  uint32_t kind;
+  struct imu_block block;
+};
+
+struct imu_shm_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t slot_count;
+  uint32_t slot_size;
+  _Alignas(IMU_BLOCK_ALIGN) _Atomic uint64_t head; // last published block
+};
+
+struct imu_shm {
+  int fd;
+  size_t map_size;
+  struct imu_shm_header *hdr;
+  struct imu_shm_slot *slots;
+  uint64_t claimed; // writer side: block being filled, 0 when none
+};
+
+struct imu_shm_reader {
+  const struct imu_shm *shm;
+  uint64_t next; // sequence of the next block to read
+  uint64_t lost;
+};
+
+// Writer. name is a shm_open name ("/imu0"); NULL creates an anonymous
+// memfd whose s->fd can be handed to consumers over a unix socket or fork.
+int imu_shm_create(struct imu_shm *s, const char *name, uint32_t slot_count);
+// Reader side mapping, read-only. fd < 0 opens name instead.
+int imu_shm_open(struct imu_shm *s, const char *name, int fd);
+void imu_shm_close(struct imu_shm *s);
+int imu_shm_unlink(const char *name);
+
+// Zero-copy publish: fill the returned block in place, then publish.
+struct imu_block *imu_shm_claim(struct imu_shm *s, uint32_t device,
+                                enum imu_shm_kind kind);
+void imu_shm_publish(struct imu_shm *s);
+int imu_shm_write(struct imu_shm *s, uint32_t device, enum imu_shm_kind kind,
+                  const struct imu_block *b);
+
+// Starts at the oldest block still in the ring; live readers usually
+// call imu_shm_reader_tail after to see only new blocks.
+void imu_shm_reader_init(struct imu_shm_reader *r, const struct imu_shm *s);
+void imu_shm_reader_tail(struct imu_shm_reader *r);
+
+// Copies the next block out. Returns IMU_OK, IMU_E_NOT_READY when nothing
+// new was published, or IMU_SHM_LAPPED when the writer overtook the reader
+// (r->lost grows and the next call resumes at the oldest valid block).
+int imu_shm_read(struct imu_shm_reader *r, struct imu_block *out,
+                 uint32_t *device, enum imu_shm_kind *kind);
+
+// Zero-copy read: use the slot in place, then confirm with release that
+// the writer did not touch it meanwhile; on IMU_SHM_LAPPED discard what
+// was computed from it.
+const struct imu_shm_slot *imu_shm_acquire(struct imu_shm_reader *r);
+int imu_shm_release(struct imu_shm_reader *r, const struct imu_shm_slot *slot);
+
+#endif // IMU_SHM_H
@@ -0,0 +1,159 @@
+#include "imu_stats.h"
+#include "imu_error.h"
+#include <math.h>
+#include <string.h>
+
+void imu_stats_reset(struct imu_stats *s) {
+  for (unsigned a = 0; a < 3; a++) {
+    s->axis[a].n = 0;
+    s->axis[a].mean = 0.0;
+    s->axis[a].m2 = 0.0;
+    s->axis[a].min = INT16_MAX;
+    s->axis[a].max = INT16_MIN;
+  }
+}
+
+// Chan et al.: combines two (n, mean, M2) partials exactly.
+static void merge_axis(struct imu_stats_axis *d, uint64_t nb, double mb,
+                       double m2b, int16_t lo, int16_t hi) {
+  uint64_t n;
+  double delta;
+
+  if (nb == 0)
+    return;
+  n = d->n + nb;
+  delta = mb - d->mean;
+  d->mean += delta * (double)nb / (double)n;
+  d->m2 += m2b + delta * delta * (double)d->n * (double)nb / (double)n;
+  d->n = n;
+  if (lo < d->min)
+    d->min = lo;
+  if (hi > d->max)
+    d->max = hi;
+}
+
+// Integer moments of one lane; exact for any n up to IMU_BLOCK_CAP.
+static void push_lane(struct imu_stats_axis *d, const int16_t *v, size_t n) {
+  int64_t sum = 0, sq = 0;
+  int16_t lo = INT16_MAX, hi = INT16_MIN;
+  double mean;
+
+  if (n == 0)
+    return;
+#pragma omp simd reduction(+ : sum, sq) reduction(min : lo) reduction(max : hi)
+  for (size_t i = 0; i < n; i++) {
+    int64_t x = v[i];
+    sum += x;
+    sq += x * x;
+    lo = v[i] < lo ? v[i] : lo;
+    hi = v[i] > hi ? v[i] : hi;
+  }
+  mean = (double)sum / (double)n;
+  merge_axis(d, n, mean, (double)sq - (double)sum * mean, lo, hi);
+}
+
+static void push_range(struct imu_stats *s, const struct imu_block *b,
+                       size_t from, size_t to) {
+  push_lane(&s->axis[0], &b->x[from], to - from);
+  push_lane(&s->axis[1], &b->y[from], to - from);
+  push_lane(&s->axis[2], &b->z[from], to - from);
+}
+
+void imu_stats_push_block(struct imu_stats *s, const struct imu_block *b) {
+  push_range(s, b, 0, b->n);
+}
+
+void imu_stats_push_aos(struct imu_stats *s, const struct bmi08_sensor_data *in,
+                        size_t n) {
+  _Alignas(IMU_BLOCK_ALIGN) int16_t lane[3][IMU_BLOCK_CAP];
+
+  // Transposed a block at a time so the lane kernel stays contiguous.
+  for (size_t off = 0; off < n; off += IMU_BLOCK_CAP) {
+    size_t k = n - off < IMU_BLOCK_CAP ? n - off : IMU_BLOCK_CAP;
+    for (size_t i = 0; i < k; i++) {
+      lane[0][i] = in[off + i].x;
+      lane[1][i] = in[off + i].y;
+      lane[2][i] = in[off + i].z;
+    }
+    for (unsigned a = 0; a < 3; a++)
+      push_lane(&s->axis[a], lane[a], k);
+  }
+}
+
+void imu_stats_merge(struct imu_stats *dst, const struct imu_stats *src) {
+  for (unsigned a = 0; a < 3; a++) {
+    const struct imu_stats_axis *x = &src->axis[a];
+    merge_axis(&dst->axis[a], x->n, x->mean, x->m2, x->min, x->max);
+  }
+}
+
+void imu_stats_summarize(const struct imu_stats *s,
+                         struct imu_stats_summary *out) {
+  out->n = (uint32_t)s->axis[0].n;
+  for (unsigned a = 0; a < 3; a++) {
+    const struct imu_stats_axis *x = &s->axis[a];
+    double var = x->n > 0 ? x->m2 / (double)x->n : 0.0;
+
+    if (var < 0.0)
+      var = 0.0;
+    out->mean[a] = (float)x->mean;
+    out->std[a] = (float)sqrt(var);
+    out->rms[a] = (float)sqrt(var + x->mean * x->mean);
+    out->min[a] = x->n > 0 ? x->min : 0;
+    out->max[a] = x->n > 0 ? x->max : 0;
+  }
+}
+
+int imu_stats_bank_init(struct imu_stats_bank *bank, unsigned streams,
+                        uint64_t window_ns, uint64_t start_ns) {
+  if (bank == NULL)
+    return IMU_E_NULL_PTR;
+  if (streams == 0 || streams > IMU_STATS_MAX_STREAMS || window_ns == 0)
+    return IMU_E_INVALID_INPUT;
+
+  memset(bank, 0, sizeof(*bank));
+  bank->streams = streams;
+  bank->window_ns = window_ns;
+  bank->end_ns = start_ns + window_ns;
+  for (unsigned i = 0; i < streams; i++) {
+    imu_stats_reset(&bank->cur[i]);
+    imu_stats_reset(&bank->next[i]);
+  }
+  return IMU_OK;
+}
+
+int imu_stats_bank_push(struct imu_stats_bank *bank, unsigned stream,
+                        const struct imu_block *b) {
+  size_t split = 0;
+
+  if (bank == NULL || b == NULL)
+    return IMU_E_NULL_PTR;
+  if (stream >= bank->streams)
+    return IMU_E_INVALID_INPUT;
+  if (b->n == 0)
+    return IMU_OK;
+
+  // t is ascending within a block, so one search finds the boundary.
+  while (split < b->n && b->t[split] < bank->end_ns)
+    split++;
+  push_range(&bank->cur[stream], b, 0, split);
+  push_range(&bank->next[stream], b, split, b->n);
+  bank->last_t[stream] = b->t[b->n - 1];
+  if (split < b->n)
+    bank->passed |= 1u << stream;
+  if (bank->passed != (1u << bank->streams) - 1)
+    return IMU_OK;
+
+  bank->out_start_ns = bank->end_ns - bank->window_ns;
+  bank->end_ns += bank->window_ns;
+  bank->passed = 0;
+  for (unsigned i = 0; i < bank->streams; i++) {
+    imu_stats_summarize(&bank->cur[i], &bank->out[i]);
+    bank->cur[i] = bank->next[i];
+    imu_stats_reset(&bank->next[i]);
+    if (bank->last_t[i] >= bank->end_ns)
+      bank->passed |= 1u << i;
+  }
+  bank->seq++;
+  return IMU_STATS_WINDOW;
+}
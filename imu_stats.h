@@ -0,0 +1,76 @@
+#ifndef IMU_STATS_H
+#define IMU_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_block.h"
+
+// Streaming per-axis statistics on raw int16 samples. Each block is
+// reduced with exact integer sums (count, sum, sum of squares, min, max)
+// in one vectorised pass, then folded into the running mean / M2 with
+// Chan's parallel form of Welford's update, the same merge that combines
+// partial results from other threads. A bank holds one accumulator per
+// stream (device and sensor) and publishes all of them together per time
+// window.
+
+#define IMU_STATS_MAX_STREAMS 16
+
+// Outcome of imu_stats_bank_push besides the IMU_E_* codes.
+#define IMU_STATS_WINDOW 1 // bank->out holds a finished window
+
+struct imu_stats_axis {
+  uint64_t n;
+  double mean;
+  double m2; // sum of squared deviations from the mean
+  int16_t min;
+  int16_t max;
+};
+
+struct imu_stats {
+  struct imu_stats_axis axis[3];
+};
+
+struct imu_stats_summary {
+  uint32_t n;
+  float mean[3];
+  float std[3]; // population
+  float rms[3];
+  int16_t min[3];
+  int16_t max[3];
+};
+
+void imu_stats_reset(struct imu_stats *s);
+void imu_stats_push_block(struct imu_stats *s, const struct imu_block *b);
+void imu_stats_push_aos(struct imu_stats *s, const struct bmi08_sensor_data *in,
+                        size_t n);
+// Folds src into dst; both may come from different threads.
+void imu_stats_merge(struct imu_stats *dst, const struct imu_stats *src);
+void imu_stats_summarize(const struct imu_stats *s,
+                         struct imu_stats_summary *out);
+
+// Windows are [start + k * window, start + (k + 1) * window). A stream may
+// run at most one window ahead of the slowest one; later samples are
+// counted in the next window.
+struct imu_stats_bank {
+  unsigned streams;
+  uint64_t window_ns;
+  uint64_t end_ns; // end of the window being filled
+  uint32_t seq;    // windows published so far
+  uint32_t passed; // bit per stream that reached end_ns
+  struct imu_stats cur[IMU_STATS_MAX_STREAMS];
+  struct imu_stats next[IMU_STATS_MAX_STREAMS];
+  uint64_t last_t[IMU_STATS_MAX_STREAMS];
+  uint64_t out_start_ns;
+  struct imu_stats_summary out[IMU_STATS_MAX_STREAMS];
+};
+
+int imu_stats_bank_init(struct imu_stats_bank *bank, unsigned streams,
+                        uint64_t window_ns, uint64_t start_ns);
+// Returns IMU_STATS_WINDOW when every stream has moved past the current
+// window, which is then summarised into bank->out.
+int imu_stats_bank_push(struct imu_stats_bank *bank, unsigned stream,
+                        const struct imu_block *b);
+
+#endif // IMU_STATS_H
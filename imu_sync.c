@@ -0,0 +1,85 @@
+#include "imu_sync.h"
+#include "imu_error.h"
+#include <string.h>
+
+void imu_sync_init(struct imu_sync_index *s) { memset(s, 0, sizeof(*s)); }
+
+void imu_sync_note(struct imu_sync_index *s, uint16_t tag, uint64_t t) {
+  uint8_t active = tag != 0;
+
+  // A pulse longer than one ODR period tags several frames; only its
+  // leading edge is an event.
+  if (active && !s->active) {
+    struct imu_sync_event *ev;
+
+    if (s->count == IMU_SYNC_MAX_EVENTS) {
+      s->head = (s->head + 1) % IMU_SYNC_MAX_EVENTS;
+      s->count--;
+      s->dropped++;
+    }
+    ev = &s->ev[(s->head + s->count) % IMU_SYNC_MAX_EVENTS];
+    ev->frame = s->frames;
+    ev->t = t;
+    ev->tag = tag;
+    s->count++;
+  }
+  s->active = active;
+  s->frames++;
+}
+
+const struct imu_sync_event *imu_sync_event(const struct imu_sync_index *s,
+                                            size_t i) {
+  if (s == NULL || i >= s->count)
+    return NULL;
+  return &s->ev[(s->head + i) % IMU_SYNC_MAX_EVENTS];
+}
+
+const struct imu_sync_event *imu_sync_nearest(const struct imu_sync_index *s,
+                                              uint64_t t_ns) {
+  size_t lo = 0, hi;
+  const struct imu_sync_event *a, *b;
+
+  if (s == NULL || s->count == 0)
+    return NULL;
+
+  // First event at or after t_ns; events are in time order.
+  hi = s->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (imu_sync_event(s, mid)->t < t_ns)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo == s->count)
+    return imu_sync_event(s, lo - 1);
+  b = imu_sync_event(s, lo);
+  if (lo == 0)
+    return b;
+  a = imu_sync_event(s, lo - 1);
+  return t_ns - a->t <= b->t - t_ns ? a : b;
+}
+
+int imu_sync_seek(const struct imu_block *b, uint64_t t_ns, size_t *pos) {
+  size_t lo = 0, hi;
+
+  if (b == NULL || pos == NULL)
+    return IMU_E_NULL_PTR;
+  if (b->n == 0)
+    return IMU_E_NOT_FOUND;
+
+  hi = b->n;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (b->t[mid] < t_ns)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo == b->n)
+    lo--;
+  else if (lo > 0 && t_ns - b->t[lo - 1] <= b->t[lo] - t_ns)
+    lo--;
+  *pos = lo;
+  return IMU_OK;
+}
@@ -0,0 +1,50 @@
+#ifndef IMU_SYNC_H
+#define IMU_SYNC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "imu_block.h"
+
+// Gyro FIFO external-sync markers. With bmi08g_set_fifo_ext_int_sync and
+// the FIFO tag enabled, every gyro frame carries two tag bytes holding the
+// INT3/INT4 pin state. The gyro extractors feed them here; a rising edge
+// becomes an event with the frame's position and timestamp, so camera or
+// LiDAR triggers line up with gyro samples without GPIO timestamping on
+// the host.
+
+#define IMU_SYNC_MAX_EVENTS 64
+
+struct imu_sync_event {
+  uint64_t frame; // gyro frames extracted before this one
+  uint64_t t;     // ns, from the block clock
+  uint16_t tag;
+};
+
+// Ring of the most recent events, oldest first.
+struct imu_sync_index {
+  struct imu_sync_event ev[IMU_SYNC_MAX_EVENTS];
+  size_t head;
+  size_t count;
+  uint64_t frames;
+  uint32_t dropped; // events overwritten before being read
+  uint8_t active;
+};
+
+void imu_sync_init(struct imu_sync_index *s);
+
+// Called once per tagged gyro frame, in FIFO order.
+void imu_sync_note(struct imu_sync_index *s, uint16_t tag, uint64_t t);
+
+// i-th stored event, 0 being the oldest; NULL when out of range.
+const struct imu_sync_event *imu_sync_event(const struct imu_sync_index *s,
+                                            size_t i);
+
+// Stored event closest in time to t_ns, NULL when there is none.
+const struct imu_sync_event *imu_sync_nearest(const struct imu_sync_index *s,
+                                              uint64_t t_ns);
+
+// Index of the sample in b closest in time to t_ns, e.g. an event's t.
+int imu_sync_seek(const struct imu_block *b, uint64_t t_ns, size_t *pos);
+
+#endif // IMU_SYNC_H
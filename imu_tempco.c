@@ -0,0 +1,202 @@
+#include "imu_tempco.h"
+#include "bmi08.h"
+#include "imu_error.h"
+#include <math.h>
+#include <string.h>
+
+// Polynomials are evaluated in (T - 25 degC) / 10 degC to keep the normal
+// equations well conditioned.
+#define TEMPCO_REF_MC 25000
+#define TEMPCO_SCALE_MC 10000.0
+
+static double norm_temp(int32_t temp_mc) {
+  return (double)(temp_mc - TEMPCO_REF_MC) / TEMPCO_SCALE_MC;
+}
+
+static int clamp_index(int32_t temp_mc) {
+  if (temp_mc <= IMU_TEMPCO_MIN_MC)
+    return 0;
+  if (temp_mc >= IMU_TEMPCO_MAX_MC)
+    return IMU_TEMPCO_LUT_SIZE - 1;
+  return (temp_mc - IMU_TEMPCO_MIN_MC + IMU_TEMPCO_STEP_MC / 2) /
+         IMU_TEMPCO_STEP_MC;
+}
+
+void imu_tempco_sampler_init(struct imu_tempco_sampler *s,
+                             uint32_t period_samples) {
+  s->period_samples = period_samples;
+  s->countdown = 0;
+  s->temp_mc = 0;
+  s->valid = 0;
+}
+
+int imu_tempco_poll(struct imu_tempco_sampler *s, struct bmi08_dev *dev,
+                    size_t n) {
+  int32_t temp;
+  int8_t rslt;
+
+  if (s->valid && s->countdown > n) {
+    s->countdown -= (uint32_t)n;
+    return 0;
+  }
+
+  rslt = bmi08a_get_sensor_temperature(dev, &temp);
+  if (rslt != BMI08_OK)
+    return rslt;
+
+  s->temp_mc = temp;
+  s->valid = 1;
+  s->countdown = s->period_samples;
+  return 1;
+}
+
+int imu_tempco_model_init(struct imu_tempco_model *m, unsigned order) {
+  if (m == NULL)
+    return IMU_E_NULL_PTR;
+  if (order > IMU_TEMPCO_MAX_ORDER)
+    return IMU_E_INVALID_INPUT;
+
+  memset(m, 0, sizeof(*m));
+  m->order = order;
+  return IMU_OK;
+}
+
+void imu_tempco_add_point(struct imu_tempco_model *m, int32_t temp_mc,
+                          const float bias[3]) {
+  double p[IMU_TEMPCO_MAX_ORDER * 2 + 1];
+  double t = norm_temp(temp_mc);
+  unsigned terms = m->order + 1;
+
+  p[0] = 1.0;
+  for (unsigned k = 1; k < terms * 2 - 1; k++)
+    p[k] = p[k - 1] * t;
+
+  for (unsigned r = 0; r < terms; r++) {
+    for (unsigned c = 0; c < terms; c++)
+      m->ata[r][c] += p[r + c];
+    for (int a = 0; a < 3; a++)
+      m->atb[a][r] += p[r] * bias[a];
+  }
+  m->points++;
+}
+
+int imu_tempco_fit(struct imu_tempco_model *m) {
+  double a[IMU_TEMPCO_MAX_ORDER + 1][IMU_TEMPCO_MAX_ORDER + 1 + 3];
+  unsigned n = m->order + 1;
+
+  if (m->points < n)
+    return IMU_E_NOT_READY;
+
+  // Gauss-Jordan with partial pivoting, all three axes share the matrix.
+  for (unsigned r = 0; r < n; r++) {
+    for (unsigned c = 0; c < n; c++)
+      a[r][c] = m->ata[r][c];
+    for (int ax = 0; ax < 3; ax++)
+      a[r][n + ax] = m->atb[ax][r];
+  }
+  for (unsigned col = 0; col < n; col++) {
+    unsigned piv = col;
+    for (unsigned r = col + 1; r < n; r++) {
+      if (fabs(a[r][col]) > fabs(a[piv][col]))
+        piv = r;
+    }
+    if (fabs(a[piv][col]) < 1e-12)
+      return IMU_E_NOT_READY;
+    if (piv != col) {
+      for (unsigned c = 0; c < n + 3; c++) {
+        double tmp = a[col][c];
+        a[col][c] = a[piv][c];
+        a[piv][c] = tmp;
+      }
+    }
+    for (unsigned r = 0; r < n; r++) {
+      double f;
+      if (r == col)
+        continue;
+      f = a[r][col] / a[col][col];
+      for (unsigned c = col; c < n + 3; c++)
+        a[r][c] -= f * a[col][c];
+    }
+  }
+
+  for (int ax = 0; ax < 3; ax++) {
+    for (unsigned k = 0; k <= IMU_TEMPCO_MAX_ORDER; k++)
+      m->coef[ax][k] = k < n ? (float)(a[k][n + ax] / a[k][k]) : 0.0f;
+  }
+  return IMU_OK;
+}
+
+float imu_tempco_eval(const struct imu_tempco_model *m, int axis,
+                      int32_t temp_mc) {
+  double t = norm_temp(temp_mc);
+  double v = 0.0;
+
+  for (int k = (int)m->order; k >= 0; k--)
+    v = v * t + m->coef[axis][k];
+  return (float)v;
+}
+
+void imu_tempco_build_lut(const struct imu_tempco_model *m,
+                          struct imu_tempco_lut *lut) {
+  for (int i = 0; i < IMU_TEMPCO_LUT_SIZE; i++) {
+    int32_t temp_mc = IMU_TEMPCO_MIN_MC + i * IMU_TEMPCO_STEP_MC;
+    for (int a = 0; a < 3; a++) {
+      float v = roundf(imu_tempco_eval(m, a, temp_mc));
+      if (v > INT16_MAX)
+        v = INT16_MAX;
+      else if (v < INT16_MIN)
+        v = INT16_MIN;
+      lut->bias[i][a] = (int16_t)v;
+    }
+  }
+}
+
+const int16_t *imu_tempco_lookup(const struct imu_tempco_lut *lut,
+                                 int32_t temp_mc) {
+  return lut->bias[clamp_index(temp_mc)];
+}
+
+// Saturates instead of wrapping a near full-scale sample to the other
+// sign. Written as min/max so the block loop still vectorises.
+static inline int16_t sat16(int32_t v) {
+  v = v < INT16_MIN ? INT16_MIN : v;
+  v = v > INT16_MAX ? INT16_MAX : v;
+  return (int16_t)v;
+}
+
+void imu_tempco_correct(const struct imu_tempco_lut *lut, int32_t temp_mc,
+                        struct bmi08_sensor_data *data, size_t n) {
+  const int16_t *b = imu_tempco_lookup(lut, temp_mc);
+  const int16_t bx = b[0], by = b[1], bz = b[2];
+
+  for (size_t i = 0; i < n; i++) {
+    data[i].x = sat16((int32_t)data[i].x - bx);
+    data[i].y = sat16((int32_t)data[i].y - by);
+    data[i].z = sat16((int32_t)data[i].z - bz);
+  }
+}
+
+void imu_tempco_correct_block(const struct imu_tempco_lut *lut,
+                              int32_t temp_mc, struct imu_block *b) {
+  const int16_t *bias = imu_tempco_lookup(lut, temp_mc);
+  int16_t *const lane[3] = {b->x, b->y, b->z};
+
+  for (int a = 0; a < 3; a++) {
+    int16_t *restrict v = lane[a];
+    const int16_t d = bias[a];
+#pragma omp simd
+    for (size_t i = 0; i < b->n; i++)
+      v[i] = sat16((int32_t)v[i] - d);
+  }
+}
+
+void imu_tempco_kernel(const struct imu_tempco_lut *lut, int32_t temp_mc,
+                       const struct imu_calib_kernel *base,
+                       struct imu_calib_kernel *out) {
+  const int16_t *b = imu_tempco_lookup(lut, temp_mc);
+
+  for (int a = 0; a < 3; a++) {
+    out->gain[a] = base->gain[a];
+    out->offset[a] = base->offset[a] - (float)b[a] * base->gain[a];
+  }
+}
@@ -0,0 +1,76 @@
+#ifndef IMU_TEMPCO_H
+#define IMU_TEMPCO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+#include "imu_calib.h"
+
+#define IMU_TEMPCO_MAX_ORDER 3
+
+// Temperatures are handled in milli-degC as returned by
+// bmi08a_get_sensor_temperature(), whose step is 0.125 degC.
+#define IMU_TEMPCO_STEP_MC 125
+#define IMU_TEMPCO_MIN_MC (-40000)
+#define IMU_TEMPCO_MAX_MC 85000
+#define IMU_TEMPCO_LUT_SIZE                                                    \
+  ((IMU_TEMPCO_MAX_MC - IMU_TEMPCO_MIN_MC) / IMU_TEMPCO_STEP_MC + 1)
+
+// Reads the temperature every period_samples samples instead of per batch.
+struct imu_tempco_sampler {
+  uint32_t period_samples;
+  uint32_t countdown;
+  int32_t temp_mc;
+  int valid;
+};
+
+// Least-squares polynomial of per-axis bias (LSB) vs temperature. Fitting is
+// done on the normal equations, so points can be added one at a time.
+struct imu_tempco_model {
+  unsigned order;
+  uint32_t points;
+  double ata[IMU_TEMPCO_MAX_ORDER + 1][IMU_TEMPCO_MAX_ORDER + 1];
+  double atb[3][IMU_TEMPCO_MAX_ORDER + 1];
+  float coef[3][IMU_TEMPCO_MAX_ORDER + 1];
+};
+
+// Bias per axis for every representable sensor temperature step.
+struct imu_tempco_lut {
+  int16_t bias[IMU_TEMPCO_LUT_SIZE][3];
+};
+
+void imu_tempco_sampler_init(struct imu_tempco_sampler *s,
+                             uint32_t period_samples);
+
+// Accounts for n new samples and reads the temperature when due. Returns 1
+// when a new reading was taken, 0 when not due, or a BMI08 error code.
+int imu_tempco_poll(struct imu_tempco_sampler *s, struct bmi08_dev *dev,
+                    size_t n);
+
+int imu_tempco_model_init(struct imu_tempco_model *m, unsigned order);
+void imu_tempco_add_point(struct imu_tempco_model *m, int32_t temp_mc,
+                          const float bias[3]);
+int imu_tempco_fit(struct imu_tempco_model *m);
+float imu_tempco_eval(const struct imu_tempco_model *m, int axis,
+                      int32_t temp_mc);
+
+void imu_tempco_build_lut(const struct imu_tempco_model *m,
+                          struct imu_tempco_lut *lut);
+const int16_t *imu_tempco_lookup(const struct imu_tempco_lut *lut,
+                                 int32_t temp_mc);
+
+// Subtracts the bias for temp_mc from n samples in place, saturating at
+// the int16 limits.
+void imu_tempco_correct(const struct imu_tempco_lut *lut, int32_t temp_mc,
+                        struct bmi08_sensor_data *data, size_t n);
+void imu_tempco_correct_block(const struct imu_tempco_lut *lut,
+                              int32_t temp_mc, struct imu_block *b);
+
+// Folds the bias for temp_mc into a calibration kernel so imu_calib_apply()
+// corrects for temperature at no extra per-sample cost.
+void imu_tempco_kernel(const struct imu_tempco_lut *lut, int32_t temp_mc,
+                       const struct imu_calib_kernel *base,
+                       struct imu_calib_kernel *out);
+
+#endif // IMU_TEMPCO_H
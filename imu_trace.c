@@ -0,0 +1,220 @@
+#include "imu_trace.h"
+#include "imu_clock.h"
+#include <string.h>
+
+// Upper edge of a bucket, so percentiles never under-report.
+static uint64_t hist_value(unsigned idx) {
+  unsigned shift;
+
+  if (idx < 2 * IMU_HIST_SUB)
+    return idx;
+  shift = idx / IMU_HIST_SUB - 1;
+  return (((uint64_t)(IMU_HIST_SUB + idx % IMU_HIST_SUB) + 1) << shift) - 1;
+}
+
+uint64_t imu_hist_percentile(const struct imu_hist *h, double pct) {
+  uint64_t target, seen = 0;
+
+  if (h->count == 0)
+    return 0;
+  target = (uint64_t)(pct / 100.0 * (double)h->count + 0.5);
+  if (target == 0)
+    target = 1;
+  for (unsigned i = 0; i < IMU_HIST_BUCKETS; i++) {
+    seen += h->buckets[i];
+    if (seen >= target) {
+      uint64_t v = hist_value(i);
+      return v < h->max ? v : h->max;
+    }
+  }
+  return h->max;
+}
+
+#ifdef IMU_TRACE
+
+static unsigned hist_index(uint64_t v) {
+  unsigned msb, shift;
+
+  if (v < 2 * IMU_HIST_SUB)
+    return (unsigned)v;
+  msb = 63 - (unsigned)__builtin_clzll(v);
+  if (msb >= IMU_HIST_MAX_BITS)
+    return IMU_HIST_BUCKETS - 1;
+  shift = msb - IMU_HIST_SUB_BITS;
+  return (shift + 1) * IMU_HIST_SUB + (unsigned)((v >> shift) - IMU_HIST_SUB);
+}
+
+static void hist_record(struct imu_hist *h, uint64_t v) {
+  h->buckets[hist_index(v)]++;
+  h->count++;
+  if (v > h->max)
+    h->max = v;
+}
+
+static void record(struct imu_trace *t, int is_write, uint32_t len,
+                   uint64_t ns, BMI08_INTF_RET_TYPE rslt) {
+  struct imu_trace_api_stats *api = &t->stats.api[t->current];
+
+  if (is_write) {
+    api->writes++;
+    api->bytes_written += len;
+    hist_record(&t->stats.write_latency, ns);
+  } else {
+    api->reads++;
+    api->bytes_read += len;
+    hist_record(&t->stats.read_latency, ns);
+  }
+  if (rslt != BMI08_INTF_RET_SUCCESS)
+    api->errors++;
+  hist_record(&api->latency, ns);
+}
+
+static BMI08_INTF_RET_TYPE trace_read(uint8_t reg_addr, uint8_t *reg_data,
+                                      uint32_t len, void *intf_ptr) {
+  struct imu_trace_port *port = intf_ptr;
+  struct imu_trace *t = port->trace;
+  uint64_t start = imu_now_ns();
+  BMI08_INTF_RET_TYPE rslt = t->read(reg_addr, reg_data, len, port->intf_ptr);
+
+  record(t, 0, len, imu_now_ns() - start, rslt);
+  return rslt;
+}
+
+static BMI08_INTF_RET_TYPE trace_write(uint8_t reg_addr,
+                                       const uint8_t *reg_data, uint32_t len,
+                                       void *intf_ptr) {
+  struct imu_trace_port *port = intf_ptr;
+  struct imu_trace *t = port->trace;
+  uint64_t start = imu_now_ns();
+  BMI08_INTF_RET_TYPE rslt = t->write(reg_addr, reg_data, len, port->intf_ptr);
+
+  record(t, 1, len, imu_now_ns() - start, rslt);
+  return rslt;
+}
+
+// A write sequence is one transaction carrying count register bytes.
+static BMI08_INTF_RET_TYPE trace_write_seq(const struct bmi08_reg_write *seq,
+                                           uint32_t count, void *intf_ptr) {
+  struct imu_trace_port *port = intf_ptr;
+  struct imu_trace *t = port->trace;
+  uint64_t start = imu_now_ns();
+  BMI08_INTF_RET_TYPE rslt = t->write_seq(seq, count, port->intf_ptr);
+
+  record(t, 1, count, imu_now_ns() - start, rslt);
+  return rslt;
+}
+
+// The driver hands intf_ptr to the delay hook too, so it must be unwrapped.
+static void trace_delay_us(uint32_t period, void *intf_ptr) {
+  struct imu_trace_port *port = intf_ptr;
+  struct imu_trace *t = port->trace;
+
+  t->stats.api[t->current].delay_us += period;
+  t->delay_us(period, port->intf_ptr);
+}
+
+void imu_trace_reset(struct imu_trace *t) {
+  memset(&t->stats, 0, sizeof(t->stats));
+  t->stats.api[0].name = "(untracked)";
+  t->stats.api_count = 1;
+  t->current = 0;
+}
+
+void imu_trace_attach(struct imu_trace *t, struct bmi08_dev *dev) {
+  imu_trace_reset(t);
+  t->dev = dev;
+  t->read = dev->read;
+  t->write = dev->write;
+  t->write_seq = dev->write_seq;
+  t->delay_us = dev->delay_us;
+  t->accel.trace = t;
+  t->accel.intf_ptr = dev->intf_ptr_accel;
+  t->gyro.trace = t;
+  t->gyro.intf_ptr = dev->intf_ptr_gyro;
+
+  dev->read = trace_read;
+  dev->write = trace_write;
+  if (dev->write_seq != NULL)
+    dev->write_seq = trace_write_seq;
+  dev->delay_us = trace_delay_us;
+  dev->intf_ptr_accel = &t->accel;
+  dev->intf_ptr_gyro = &t->gyro;
+}
+
+void imu_trace_detach(struct imu_trace *t) {
+  struct bmi08_dev *dev = t->dev;
+
+  if (dev == NULL)
+    return;
+  dev->read = t->read;
+  dev->write = t->write;
+  dev->write_seq = t->write_seq;
+  dev->delay_us = t->delay_us;
+  dev->intf_ptr_accel = t->accel.intf_ptr;
+  dev->intf_ptr_gyro = t->gyro.intf_ptr;
+  t->dev = NULL;
+}
+
+unsigned imu_trace_begin(struct imu_trace *t, const char *api) {
+  struct imu_trace_snapshot *s = &t->stats;
+  unsigned prev = t->current;
+  unsigned i;
+
+  // Names are usually string literals, so the pointer compare hits first.
+  for (i = 1; i < s->api_count; i++) {
+    if (s->api[i].name == api || strcmp(s->api[i].name, api) == 0)
+      break;
+  }
+  if (i == s->api_count) {
+    if (s->api_count == IMU_TRACE_MAX_APIS) {
+      i = 0;
+    } else {
+      s->api[i].name = api;
+      s->api_count++;
+    }
+  }
+  s->api[i].calls++;
+  t->current = i;
+  return prev;
+}
+
+void imu_trace_end(struct imu_trace *t, unsigned prev) { t->current = prev; }
+
+void imu_trace_snapshot(const struct imu_trace *t,
+                        struct imu_trace_snapshot *out) {
+  *out = t->stats;
+}
+
+static void report_hist(FILE *out, const char *label,
+                        const struct imu_hist *h) {
+  fprintf(out, "%-36s n=%-8llu p50=%-8llu p90=%-8llu p99=%-8llu max=%llu\n",
+          label, (unsigned long long)h->count,
+          (unsigned long long)imu_hist_percentile(h, 50.0),
+          (unsigned long long)imu_hist_percentile(h, 90.0),
+          (unsigned long long)imu_hist_percentile(h, 99.0),
+          (unsigned long long)h->max);
+}
+
+void imu_trace_report(const struct imu_trace_snapshot *s, FILE *out) {
+  fprintf(out, "%-36s %8s %8s %8s %6s %10s %10s %10s\n", "api", "calls",
+          "reads", "writes", "errors", "rd_bytes", "wr_bytes", "delay_us");
+  for (unsigned i = 0; i < s->api_count; i++) {
+    const struct imu_trace_api_stats *a = &s->api[i];
+    if (a->reads == 0 && a->writes == 0 && a->delay_us == 0)
+      continue;
+    fprintf(out, "%-36s %8u %8u %8u %6u %10llu %10llu %10llu\n", a->name,
+            a->calls, a->reads, a->writes, a->errors,
+            (unsigned long long)a->bytes_read,
+            (unsigned long long)a->bytes_written,
+            (unsigned long long)a->delay_us);
+  }
+  fprintf(out, "\nlatency (ns)\n");
+  report_hist(out, "all reads", &s->read_latency);
+  report_hist(out, "all writes", &s->write_latency);
+  for (unsigned i = 0; i < s->api_count; i++) {
+    if (s->api[i].latency.count != 0)
+      report_hist(out, s->api[i].name, &s->api[i].latency);
+  }
+}
+
+#endif // IMU_TRACE
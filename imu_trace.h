@@ -0,0 +1,122 @@
+#ifndef IMU_TRACE_H
+#define IMU_TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bmi08_defs.h"
+
+// Bus transaction tracing. Build with -DIMU_TRACE to enable; otherwise the
+// functions below are empty inlines and IMU_TRACE_CALL is a plain call.
+
+#define IMU_TRACE_MAX_APIS 32
+
+// Log-linear (HDR style) latency buckets: exact below 32 ns, then 16
+// sub-buckets per power of two up to 2^40 ns.
+#define IMU_HIST_SUB_BITS 4
+#define IMU_HIST_SUB (1u << IMU_HIST_SUB_BITS)
+#define IMU_HIST_MAX_BITS 40
+#define IMU_HIST_BUCKETS                                                       \
+  ((IMU_HIST_MAX_BITS - IMU_HIST_SUB_BITS + 1) * IMU_HIST_SUB)
+
+struct imu_hist {
+  uint64_t count;
+  uint64_t max;
+  uint32_t buckets[IMU_HIST_BUCKETS];
+};
+
+struct imu_trace_api_stats {
+  const char *name;
+  uint32_t calls;
+  uint32_t reads;
+  uint32_t writes;
+  uint32_t errors;
+  uint64_t bytes_read;
+  uint64_t bytes_written;
+  uint64_t delay_us;
+  struct imu_hist latency;
+};
+
+// Slot 0 collects transactions issued outside any IMU_TRACE_CALL.
+struct imu_trace_snapshot {
+  unsigned api_count;
+  struct imu_trace_api_stats api[IMU_TRACE_MAX_APIS];
+  struct imu_hist read_latency;
+  struct imu_hist write_latency;
+};
+
+struct imu_trace;
+
+// What the wrapped hooks receive as intf_ptr, one per sensor.
+struct imu_trace_port {
+  struct imu_trace *trace;
+  void *intf_ptr;
+};
+
+struct imu_trace {
+  struct bmi08_dev *dev;
+  bmi08_read_fptr_t read;
+  bmi08_write_fptr_t write;
+  bmi08_write_seq_fptr_t write_seq;
+  bmi08_delay_us_fptr_t delay_us;
+  struct imu_trace_port accel;
+  struct imu_trace_port gyro;
+  unsigned current;
+  struct imu_trace_snapshot stats;
+};
+
+uint64_t imu_hist_percentile(const struct imu_hist *h, double pct);
+
+#ifdef IMU_TRACE
+
+// Swaps the transport hooks of dev for timing wrappers. The trace must
+// outlive the attachment; detach restores the original hooks.
+void imu_trace_attach(struct imu_trace *t, struct bmi08_dev *dev);
+void imu_trace_detach(struct imu_trace *t);
+void imu_trace_reset(struct imu_trace *t);
+
+unsigned imu_trace_begin(struct imu_trace *t, const char *api);
+void imu_trace_end(struct imu_trace *t, unsigned prev);
+
+void imu_trace_snapshot(const struct imu_trace *t,
+                        struct imu_trace_snapshot *out);
+void imu_trace_report(const struct imu_trace_snapshot *s, FILE *out);
+
+// Attributes the transactions of one driver call to the function's name:
+//   IMU_TRACE_CALL(&trace, rslt, bmi08a_get_data, &accel, &dev);
+#define IMU_TRACE_CALL(t, rslt, fn, ...)                                       \
+  do {                                                                         \
+    unsigned imu_trace_prev_ = imu_trace_begin((t), #fn);                      \
+    (rslt) = fn(__VA_ARGS__);                                                  \
+    imu_trace_end((t), imu_trace_prev_);                                       \
+  } while (0)
+
+#else
+
+static inline void imu_trace_attach(struct imu_trace *t,
+                                    struct bmi08_dev *dev) {
+  (void)t;
+  (void)dev;
+}
+static inline void imu_trace_detach(struct imu_trace *t) { (void)t; }
+static inline void imu_trace_reset(struct imu_trace *t) { (void)t; }
+static inline void imu_trace_snapshot(const struct imu_trace *t,
+                                      struct imu_trace_snapshot *out) {
+  (void)t;
+  out->api_count = 0;
+}
+static inline void imu_trace_report(const struct imu_trace_snapshot *s,
+                                    FILE *out) {
+  (void)s;
+  (void)out;
+}
+
+#define IMU_TRACE_CALL(t, rslt, fn, ...)                                       \
+  do {                                                                         \
+    (void)(t);                                                                 \
+    (rslt) = fn(__VA_ARGS__);                                                  \
+  } while (0)
+
+#endif // IMU_TRACE
+
+#endif // IMU_TRACE_H
@@ -0,0 +1,155 @@
+#include "imu_warm.h"
+#include "bmi08.h"
+#include "imu_error.h"
+#include <stdio.h>
+#include <string.h>
+
+#define IMU_WARM_FILE_MAGIC 0x4d524157u // "WARM"
+#define IMU_WARM_FILE_VERSION 1u
+
+// INTERNAL_STAT bits 0..4 hold the init message; the upper bits flag
+// remap and ODR errors that do not invalidate the loaded blob.
+#define IMU_WARM_STAT_MSG_MASK 0x1Fu
+
+struct warm_file {
+  uint32_t magic;
+  uint32_t version;
+  struct imu_warm_record rec;
+  uint32_t sum;
+};
+
+#define FNV_BASIS 2166136261u
+
+static uint32_t fnv1a(uint32_t h, const uint8_t *data, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+uint32_t imu_warm_fingerprint(const uint8_t *blob, uint32_t len) {
+  return fnv1a(FNV_BASIS, blob, len);
+}
+
+// Hashes the unpacked image, so packed and plain copies of the same blob
+// share a fingerprint.
+static int8_t config_fingerprint(const struct bmi08_dev *dev, uint32_t *h) {
+  struct bmi08_config_stream stream;
+  uint8_t chunk[BMI08_CONFIG_BURST_MAX];
+  int8_t rslt = bmi08a_config_stream_init(&stream, dev);
+
+  *h = FNV_BASIS;
+  for (uint32_t i = 0; i < BMI08_CONFIG_STREAM_SIZE && rslt == BMI08_OK;
+       i += sizeof(chunk)) {
+    rslt = bmi08a_config_stream_read(&stream, chunk, sizeof(chunk));
+    *h = fnv1a(*h, chunk, sizeof(chunk));
+  }
+  return rslt;
+}
+
+static int8_t read_version(struct bmi08_dev *dev, imu_warm_version_fn version,
+                           uint16_t *major, uint16_t *minor) {
+  *major = 0;
+  *minor = 0;
+  return version != NULL ? version(major, minor, dev) : BMI08_OK;
+}
+
+int imu_warm_attach(struct bmi08_dev *dev, imu_warm_version_fn version,
+                    struct imu_warm_record *rec, int8_t *bmi_rslt) {
+  uint32_t fingerprint;
+  uint16_t major, minor;
+  uint8_t stat = 0;
+  int8_t rslt;
+
+  if (dev == NULL || rec == NULL || dev->config_file_ptr == NULL)
+    return IMU_E_NULL_PTR;
+
+  rslt = config_fingerprint(dev, &fingerprint);
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_init(dev);
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_get_set_regs(BMI08_REG_ACCEL_INTERNAL_STAT, &stat, 1, dev,
+                               GET_FUNC);
+  if (rslt == BMI08_OK && rec->valid &&
+      rec->accel_chip_id == dev->accel_chip_id &&
+      rec->fingerprint == fingerprint &&
+      (stat & IMU_WARM_STAT_MSG_MASK) == BMI08_INIT_OK) {
+    // Another binary may have loaded a different blob since; its version
+    // word is the only part of the running config the chip will report.
+    rslt = read_version(dev, version, &major, &minor);
+    if (rslt == BMI08_OK && major == rec->config_major &&
+        minor == rec->config_minor) {
+      if (bmi_rslt != NULL)
+        *bmi_rslt = rslt;
+      return IMU_WARM_REUSED;
+    }
+  }
+
+  if (rslt == BMI08_OK)
+    rslt = bmi08a_load_config_file(dev);
+  if (rslt == BMI08_OK)
+    rslt = read_version(dev, version, &major, &minor);
+  if (bmi_rslt != NULL)
+    *bmi_rslt = rslt;
+  if (rslt != BMI08_OK) {
+    rec->valid = 0;
+    return IMU_E_IO;
+  }
+
+  rec->accel_chip_id = dev->accel_chip_id;
+  rec->valid = 1;
+  rec->config_major = major;
+  rec->config_minor = minor;
+  rec->fingerprint = fingerprint;
+  return IMU_WARM_UPLOADED;
+}
+
+int imu_warm_save(const struct imu_warm_record *rec, const char *path) {
+  struct warm_file wf;
+  FILE *f;
+  int ok;
+
+  if (rec == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  memset(&wf, 0, sizeof(wf));
+  wf.magic = IMU_WARM_FILE_MAGIC;
+  wf.version = IMU_WARM_FILE_VERSION;
+  wf.rec = *rec;
+  wf.sum = fnv1a(FNV_BASIS, (const uint8_t *)&wf.rec, sizeof(wf.rec));
+
+  f = fopen(path, "wb");
+  if (f == NULL)
+    return IMU_E_IO;
+  ok = fwrite(&wf, sizeof(wf), 1, f) == 1;
+  if (fclose(f) != 0)
+    ok = 0;
+
+  return ok ? IMU_OK : IMU_E_IO;
+}
+
+int imu_warm_load(struct imu_warm_record *rec, const char *path) {
+  struct warm_file wf;
+  int rslt = IMU_OK;
+  FILE *f;
+
+  if (rec == NULL || path == NULL)
+    return IMU_E_NULL_PTR;
+
+  f = fopen(path, "rb");
+  if (f == NULL)
+    return IMU_E_IO;
+  if (fread(&wf, sizeof(wf), 1, f) != 1)
+    rslt = IMU_E_IO;
+  else if (wf.magic != IMU_WARM_FILE_MAGIC ||
+           wf.version != IMU_WARM_FILE_VERSION ||
+           wf.sum != fnv1a(FNV_BASIS, (const uint8_t *)&wf.rec,
+                            sizeof(wf.rec)))
+    rslt = IMU_E_FORMAT;
+  fclose(f);
+
+  if (rslt == IMU_OK)
+    *rec = wf.rec;
+  return rslt;
+}
@@ -0,0 +1,45 @@
+#ifndef IMU_WARM_H
+#define IMU_WARM_H
+
+#include <stdint.h>
+
+#include "bmi08_defs.h"
+
+// Warm start for the accel feature engine. The 6 KB config blob survives a
+// process restart as long as the sensor keeps power, so instead of always
+// calling bmi08a_load_config_file the chip is asked whether it is already
+// running the blob we would upload.
+
+// Outcomes of imu_warm_attach besides the negative IMU_E_* codes.
+#define IMU_WARM_REUSED 0
+#define IMU_WARM_UPLOADED 1
+
+// bmi088_mma_get_version_config and bmi088_anymotion_get_version_config
+// both fit; NULL skips the version comparison.
+typedef int8_t (*imu_warm_version_fn)(uint16_t *major, uint16_t *minor,
+                                      struct bmi08_dev *dev);
+
+// What was last uploaded to one sensor, kept by the host between runs.
+struct imu_warm_record {
+  uint32_t fingerprint; // FNV-1a of the config blob
+  uint16_t config_major;
+  uint16_t config_minor;
+  uint8_t accel_chip_id;
+  uint8_t valid;
+  uint8_t reserved[2];
+};
+
+uint32_t imu_warm_fingerprint(const uint8_t *blob, uint32_t len);
+
+// Reads the chip id and, when INTERNAL_STAT reports a loaded config whose
+// version and fingerprint match rec, leaves the sensor alone. Otherwise
+// uploads dev->config_file_ptr and refreshes rec. Returns IMU_WARM_REUSED,
+// IMU_WARM_UPLOADED or IMU_E_IO; the driver code is left in *bmi_rslt
+// when not NULL.
+int imu_warm_attach(struct bmi08_dev *dev, imu_warm_version_fn version,
+                    struct imu_warm_record *rec, int8_t *bmi_rslt);
+
+int imu_warm_save(const struct imu_warm_record *rec, const char *path);
+int imu_warm_load(struct imu_warm_record *rec, const char *path);
+
+#endif // IMU_WARM_H